@@ -0,0 +1,158 @@
+// Benchmark del seeding greedy: tiempo de Greedy::generarSolucion según n.
+//
+// Genera grafos Erdős–Rényi con grado medio fijo y compara el motor actual
+// (colas por grado + heap de pares) con el motor denso original (matriz n×n
+// y lista completa de pares ordenada), que solo se mide en tamaños pequeños.
+//
+// La segunda tabla mide la población inicial (pop_size individuos greedy):
+// armando el estado del greedy en cada individuo, compartiéndolo
+// (Greedy::Base + Greedy::Espacio) y con MotorGA::inicializar según hilos.
+//
+// Uso: ./bench/bench_greedy [grado_medio] [k] [pop_size]
+
+#include "Greedy.h"
+#include "MotorGA.h"
+#include "comun.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace std;
+using namespace bench;
+
+namespace {
+
+// Motor original: matriz densa y enumeración de todos los pares en cada paso
+vector<int> generarSolucionDensa(const Grafo& grafo, int k, Rng& gen) {
+    int n = grafo.n;
+    vector<vector<char>> adj_matrix(n, vector<char>(n, 0));
+    for (int u = 0; u < n; ++u)
+        for (int v : grafo.vecinosDe(u)) adj_matrix[u][v] = 1;
+
+    vector<int> curr_deg(n);
+    for (int i = 0; i < n; ++i) curr_deg[i] = grafo.grado(i);
+    vector<char> removed(n, 0);
+    int remaining = n;
+    vector<int> independent_set;
+
+    while (remaining > 0) {
+        vector<pair<double, vector<int>>> candidates;
+        for (int a = 0; a < n; ++a) {
+            if (removed[a]) continue;
+            candidates.push_back({(double)curr_deg[a], {a}});
+            for (int b = a + 1; b < n; ++b) {
+                if (removed[b] || adj_matrix[a][b]) continue;
+                candidates.push_back({(double)(curr_deg[a] + curr_deg[b]) / 2.0, {a, b}});
+            }
+        }
+        if (candidates.empty()) break;
+        sort(candidates.begin(), candidates.end());
+        int limit = min(k, (int)candidates.size());
+        uniform_int_distribution<> dis(0, limit - 1);
+        vector<int> bestH = candidates[dis(gen)].second;
+        independent_set.insert(independent_set.end(), bestH.begin(), bestH.end());
+
+        vector<int> Slist;
+        vector<char> inS(n, 0);
+        for (int x : bestH) { inS[x] = 1; Slist.push_back(x); }
+        for (int x : bestH)
+            for (int nb : grafo.vecinosDe(x))
+                if (!inS[nb] && !removed[nb]) { inS[nb] = 1; Slist.push_back(nb); }
+        for (int s : Slist) {
+            if (removed[s]) continue;
+            removed[s] = 1;
+            remaining--;
+            for (int nb : grafo.vecinosDe(s)) if (!removed[nb]) curr_deg[nb]--;
+            curr_deg[s] = 0;
+        }
+    }
+    return independent_set;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    double grado_medio = (argc > 1) ? atof(argv[1]) : 10.0;
+    int k = (argc > 2) ? atoi(argv[2]) : 10;
+    const int max_n_denso = 1000;  // el motor denso tarda ~10 s por corrida en n=1000
+
+    cout << "# Seeding greedy, grado medio " << grado_medio << ", k = " << k << endl;
+    cout << setw(9) << "n" << setw(12) << "m"
+         << setw(14) << "colas_ms" << setw(10) << "|IS|"
+         << setw(14) << "denso_ms" << setw(10) << "|IS|" << endl;
+
+    for (int n : {500, 1000, 2000, 5000, 10000, 50000, 100000, 1000000}) {
+        Grafo grafo = generarErdosRenyi(n, grado_medio, n);
+        long long m = grafo.numAristas();
+
+        int repeticiones = n <= 10000 ? 9 : 3;
+        size_t tam = 0;
+        double t = medianaMs(repeticiones, [&](int r) {
+            Rng gen(Rng::Tipo::MT19937_64, r);
+            tam = Greedy::generarSolucion(grafo, k, gen).size();
+        });
+
+        cout << setw(9) << n << setw(12) << m << setw(14) << fixed << setprecision(3) << t
+             << setw(10) << tam;
+
+        if (n <= max_n_denso) {
+            size_t tam_denso = 0;
+            double t_denso = medianaMs(1, [&](int r) {
+                Rng gen(Rng::Tipo::MT19937_64, r);
+                tam_denso = generarSolucionDensa(grafo, k, gen).size();
+            });
+            cout << setw(14) << t_denso << setw(10) << tam_denso;
+        } else {
+            cout << setw(14) << "-" << setw(10) << "-";
+        }
+        cout << endl;
+    }
+
+    int pop_size = (argc > 3) ? atoi(argv[3]) : 100;
+    int max_hilos = max(1u, thread::hardware_concurrency());
+    vector<int> hilos;
+    for (int h = 1; h < max_hilos; h *= 2) hilos.push_back(h);
+    hilos.push_back(max_hilos);
+
+    cout << endl << "# Población inicial greedy, pop_size = " << pop_size << " (ms)" << endl;
+    cout << setw(9) << "n" << setw(14) << "por_ind" << setw(14) << "compartido";
+    for (int h : hilos) cout << setw(12) << ("hilos=" + to_string(h));
+    cout << endl;
+
+    for (int n : {1000, 10000, 100000}) {
+        Grafo grafo = generarErdosRenyi(n, grado_medio, n);
+        int repeticiones = n <= 10000 ? 5 : 1;
+
+        double t_por_ind = medianaMs(repeticiones, [&](int r) {
+            Rng gen(Rng::Tipo::MT19937_64, r);
+            for (int i = 0; i < pop_size; ++i) Greedy::generarSolucion(grafo, k, gen);
+        });
+        double t_compartido = medianaMs(repeticiones, [&](int r) {
+            Rng gen(Rng::Tipo::MT19937_64, r);
+            Greedy::Base base(grafo);
+            Greedy::Espacio espacio;
+            for (int i = 0; i < pop_size; ++i) Greedy::generar(base, espacio, k, gen);
+        });
+        cout << setw(9) << n << setw(14) << fixed << setprecision(2) << t_por_ind
+             << setw(14) << t_compartido;
+
+        ParametrosGA params;
+        params.pop_size = pop_size;
+        params.seeding_rate = 1.0;
+        params.k_greedy = k;
+        for (int h : hilos) {
+            double t = medianaMs(repeticiones, [&](int r) {
+                MotorGA motor(grafo, params, pop_size, r, h);
+                motor.inicializar();
+            });
+            cout << setw(12) << t;
+        }
+        cout << endl;
+    }
+
+    return 0;
+}
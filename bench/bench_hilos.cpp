@@ -0,0 +1,55 @@
+// Benchmark de la generación paralela de descendencia: generaciones por
+// segundo de AlgoritmoGenetico::resolver según el número de hilos.
+//
+// Uso: ./bench/bench_hilos [n] [grado_medio] [segundos] [pop_size]
+
+#include "AlgoritmoGenetico.h"
+#include "comun.h"
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace std;
+using namespace bench;
+
+int main(int argc, char** argv) {
+    int n = (argc > 1) ? atoi(argv[1]) : 20000;
+    double grado_medio = (argc > 2) ? atof(argv[2]) : 20.0;
+    double segundos = (argc > 3) ? atof(argv[3]) : 3.0;
+    int pop_size = (argc > 4) ? atoi(argv[4]) : 100;
+
+    Grafo grafo = generarErdosRenyi(n, grado_medio, 1);
+
+    ParametrosGA params;
+    params.max_time = segundos;
+    params.pop_size = pop_size;
+    params.seeding_rate = 0.0;
+    params.seed = 1;
+
+    int max_hilos = max(1u, thread::hardware_concurrency());
+    vector<int> hilos;
+    for (int h = 1; h < max_hilos; h *= 2) hilos.push_back(h);
+    hilos.push_back(max_hilos);
+
+    cout << "# Generaciones/s por hilos, n = " << n << ", m = " << grafo.numAristas()
+         << ", pop_size = " << pop_size << ", " << segundos << " s por corrida" << endl;
+    cout << setw(8) << "hilos" << setw(14) << "generaciones" << setw(12) << "gen/s"
+         << setw(12) << "speedup" << setw(10) << "mejor" << endl;
+
+    ostream nulo(nullptr);
+    double base = 0.0;
+    for (int h : hilos) {
+        params.num_hilos = h;
+        ResultadoGA r = AlgoritmoGenetico::resolver(grafo, params, nulo);
+        double gps = r.generaciones / r.tiempo_total;
+        if (h == 1) base = gps;
+        cout << setw(8) << h << setw(14) << r.generaciones
+             << setw(12) << fixed << setprecision(1) << gps
+             << setw(12) << setprecision(2) << gps / base
+             << setw(10) << r.mejor.fitness << endl;
+    }
+
+    return 0;
+}
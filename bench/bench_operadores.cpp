@@ -0,0 +1,161 @@
+// Micro-benchmarks de los operadores sobre grafos Erdős–Rényi, por n y
+// grado medio: tiempo por llamada (mediana y percentiles) de
+//   reparar_y_evaluar   (incluye copiar la entrada sin reparar)
+//   cruceUniforme, mutacionBitFlip, seleccionPorTorneo (API de Individuo)
+//   generarSolucion     (greedy, k = 10)
+//   cargarDesdeArchivo  (parseo del .graph, sin cache)
+//
+// Cada caso hace calentamiento y luego 'repeticiones' mediciones de un lote
+// de llamadas; el lote se calibra para que dure al menos ~0.5 ms. La salida
+// es TSV con columnas fijas (una fila por operador y caso), pensada para
+// compararse entre commits con bench/comparar.sh.
+//
+// Uso: ./bench/bench_operadores [ns] [grados] [repeticiones]
+//      ns y grados separados por comas, p. ej. 1000,10000 8,64
+
+#include "Greedy.h"
+#include "Operadores.h"
+#include "comun.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace bench;
+
+namespace {
+
+const int CALENTAMIENTO = 3;
+const double LOTE_MIN_US = 500.0;
+
+vector<double> listaNumeros(const string& texto) {
+    vector<double> r;
+    stringstream ss(texto);
+    string item;
+    while (getline(ss, item, ',')) r.push_back(atof(item.c_str()));
+    return r;
+}
+
+// Lote mínimo (potencia de 2) para que una medición dure LOTE_MIN_US
+template <typename F>
+int calibrarLote(F&& llamada) {
+    int lote = 1;
+    while (lote < (1 << 16)) {
+        auto t0 = Clock::now();
+        for (int i = 0; i < lote; ++i) llamada(i);
+        double us = chrono::duration<double, micro>(Clock::now() - t0).count();
+        if (us >= LOTE_MIN_US) break;
+        lote *= 2;
+    }
+    return lote;
+}
+
+template <typename F>
+void medirOperador(const char* nombre, int n, double grado, int repeticiones, F&& llamada) {
+    int lote = calibrarLote(llamada);
+    int base = 0;
+    Estadisticas e = medirUs(CALENTAMIENTO, repeticiones, lote, [&](int) {
+        for (int i = 0; i < lote; ++i) llamada(base + i);
+        base += lote;
+    });
+    cout << nombre << '\t' << n << '\t' << grado << '\t'
+         << setprecision(3) << scientific << grado / max(1, n - 1) << '\t'
+         << lote << '\t' << repeticiones << '\t' << fixed << setprecision(3)
+         << e.mediana << '\t' << e.p10 << '\t' << e.p90 << '\t' << e.p99 << endl;
+    cout.unsetf(ios::floatfield);
+    cout << setprecision(6);
+}
+
+bool escribirGrafo(const Grafo& grafo, const string& ruta) {
+    FILE* f = fopen(ruta.c_str(), "w");
+    if (!f) return false;
+    fprintf(f, "%d\n", grafo.n);
+    for (int u = 0; u < grafo.n; ++u) {
+        for (int v : grafo.vecinosDe(u)) {
+            if (u < v) fprintf(f, "%d %d\n", u, v);
+        }
+    }
+    return fclose(f) == 0;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    vector<double> ns = listaNumeros((argc > 1) ? argv[1] : "1000,10000,100000");
+    vector<double> grados = listaNumeros((argc > 2) ? argv[2] : "8,64");
+    int repeticiones = (argc > 3) ? max(1, atoi(argv[3])) : 21;
+
+    cout << "# bench_operadores v1: microsegundos por llamada" << endl;
+    cout << "operador\tn\tgrado_medio\tdensidad\tlote\trepeticiones"
+            "\tmediana_us\tp10_us\tp90_us\tp99_us" << endl;
+
+    for (double nd : ns) {
+        for (double grado : grados) {
+            int n = static_cast<int>(nd);
+            Grafo grafo = generarErdosRenyi(n, grado, 1);
+            Rng gen(Rng::Tipo::XOSHIRO256, 42);
+            size_t num_palabras = (n + 63) / 64;
+
+            // Entradas sin reparar (bits al azar) y población reparada
+            const int NUM_ENTRADAS = 64;
+            vector<Individuo> entradas;
+            vector<Individuo> poblacion;
+            for (int i = 0; i < NUM_ENTRADAS; ++i) {
+                Individuo ind(n);
+                uint64_t* w = ind.cromosoma.datos();
+                for (size_t p = 0; p < num_palabras; ++p) w[p] = gen();
+                if (n & 63) w[num_palabras - 1] &= (1ULL << (n & 63)) - 1;
+                entradas.push_back(ind);
+                Operadores::reparar_y_evaluar(ind, grafo);
+                poblacion.push_back(ind);
+            }
+            Individuo trabajo(n);
+
+            medirOperador("reparar_y_evaluar", n, grado, repeticiones, [&](int i) {
+                const Individuo& e = entradas[i % NUM_ENTRADAS];
+                memcpy(trabajo.cromosoma.datos(), e.cromosoma.datos(), num_palabras * sizeof(uint64_t));
+                Operadores::reparar_y_evaluar(trabajo, grafo);
+            });
+
+            medirOperador("cruceUniforme", n, grado, repeticiones, [&](int i) {
+                auto hijos = Operadores::cruceUniforme(poblacion[i % NUM_ENTRADAS],
+                                                       poblacion[(i + 1) % NUM_ENTRADAS], 1.0, gen);
+                trabajo.fitness = hijos.first.cromosoma.size();
+            });
+
+            medirOperador("mutacionBitFlip", n, grado, repeticiones, [&](int) {
+                Operadores::mutacionBitFlip(trabajo, 0.01, gen);
+            });
+
+            medirOperador("seleccionPorTorneo", n, grado, repeticiones, [&](int) {
+                Individuo elegido = Operadores::seleccionPorTorneo(poblacion, gen);
+                trabajo.fitness = elegido.fitness;
+            });
+
+            medirOperador("generarSolucion", n, grado, repeticiones, [&](int) {
+                vector<int> solucion = Greedy::generarSolucion(grafo, 10, gen);
+                trabajo.fitness = static_cast<int>(solucion.size());
+            });
+
+            string ruta = (filesystem::temp_directory_path() /
+                           ("bench_operadores_" + to_string(n) + "_" + to_string(static_cast<int>(grado)) +
+                            ".graph")).string();
+            if (escribirGrafo(grafo, ruta)) {
+                medirOperador("cargarDesdeArchivo", n, grado, repeticiones, [&](int) {
+                    Grafo cargado;
+                    cargado.cargarDesdeArchivo(ruta);
+                    trabajo.fitness = cargado.n;
+                });
+                filesystem::remove(ruta);
+            }
+        }
+    }
+
+    return 0;
+}
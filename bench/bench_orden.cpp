@@ -0,0 +1,103 @@
+// Benchmark de la numeración de vértices (--order) por familia de grafo.
+//
+// Para cada familia y política mide:
+// - dist: distancia media |id(u) - id(v)| sobre las aristas, relativa a n
+//   (menor = vecinos más cerca en memoria)
+// - todo-1: tamaño de la reparación del cromosoma con todos los bits en 1
+//   (la numeración es la prioridad del greedy implícito en la reparación)
+// - hijos: fitness medio de hijos (cruce uniforme + mutación de padres
+//   reparados al azar) tras reparar, como en el GA
+// - rep/s: reparaciones por segundo de esos hijos
+//
+// Las familias salen de Generadores, igual que en tools/generar_grafo: la
+// fila "powerlaw" corresponde a
+// ./tools/generar_grafo powerlaw n --grado grado_medio --seed 1.
+//
+// Uso: ./bench/bench_orden [n] [grado_medio] [p_mut]
+
+#include "Generadores.h"
+#include "Operadores.h"
+#include "Reordenamiento.h"
+#include "comun.h"
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace bench;
+
+namespace {
+
+const int NUM_PADRES = 32;
+const int NUM_HIJOS = 64;
+
+double distanciaMedia(const Grafo& grafo) {
+    double suma = 0.0;
+    for (int u = 0; u < grafo.n; ++u) {
+        for (int v : grafo.vecinosDe(u)) suma += abs(u - v);
+    }
+    return grafo.vecinos.empty() ? 0.0 : suma / grafo.vecinos.size() / grafo.n;
+}
+
+void medir(const string& familia, const Grafo& original, double p_mut) {
+    const OrdenVertices ordenes[] = {OrdenVertices::ORIGINAL, OrdenVertices::GRADO,
+                                     OrdenVertices::RCM, OrdenVertices::ALEATORIO};
+    for (OrdenVertices orden : ordenes) {
+        Grafo grafo = Reordenamiento::aplicar(original, Reordenamiento::permutacion(original, orden, 3));
+        int n = grafo.n;
+        size_t np = (n + 63) / 64;
+        uint64_t mascara = (n & 63) ? (1ULL << (n & 63)) - 1 : ~0ULL;
+
+        vector<uint64_t> trabajo(np, ~0ULL);
+        trabajo[np - 1] &= mascara;
+        int todo_uno = Operadores::reparar(trabajo.data(), np, grafo);
+
+        Rng gen(Rng::Tipo::XOSHIRO256, 7);
+        vector<uint64_t> padres(NUM_PADRES * np), hijos(NUM_HIJOS * np), descarte(np);
+        for (int i = 0; i < NUM_PADRES; ++i) {
+            uint64_t* w = &padres[i * np];
+            for (size_t p = 0; p < np; ++p) w[p] = gen();
+            w[np - 1] &= mascara;
+            Operadores::reparar(w, np, grafo);
+        }
+        for (int h = 0; h < NUM_HIJOS; ++h) {
+            Operadores::cruzar(&padres[(gen() % NUM_PADRES) * np], &padres[(gen() % NUM_PADRES) * np],
+                               &hijos[h * np], descarte.data(), np, 1.0, gen);
+            Operadores::mutar(&hijos[h * np], n, p_mut, gen);
+        }
+
+        long long suma_fitness = 0;
+        double ms = medianaMs(5, [&](int r) {
+            for (int h = 0; h < NUM_HIJOS; ++h) {
+                memcpy(trabajo.data(), &hijos[h * np], np * sizeof(uint64_t));
+                int f = Operadores::reparar(trabajo.data(), np, grafo);
+                if (r == 0) suma_fitness += f;
+            }
+        });
+
+        cout << setw(10) << familia << setw(10) << Reordenamiento::nombre(orden)
+             << setw(10) << fixed << setprecision(4) << distanciaMedia(grafo)
+             << setw(10) << todo_uno
+             << setw(12) << setprecision(1) << static_cast<double>(suma_fitness) / NUM_HIJOS
+             << setw(12) << setprecision(0) << NUM_HIJOS / (ms / 1000.0) << endl;
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int n = (argc > 1) ? atoi(argv[1]) : 200000;
+    double grado = (argc > 2) ? atof(argv[2]) : 8.0;
+    double p_mut = (argc > 3) ? atof(argv[3]) : 0.01;
+
+    cout << "# n = " << n << ", grado medio = " << grado << ", p_mut = " << p_mut << endl;
+    cout << setw(10) << "familia" << setw(10) << "orden" << setw(10) << "dist"
+         << setw(10) << "todo-1" << setw(12) << "hijos" << setw(12) << "rep/s" << endl;
+    for (const char* familia : {"erdos", "powerlaw", "geometric", "grid"}) {
+        medir(familia, Generadores::construir(familia, n, grado, 2.5, 1), p_mut);
+    }
+    return 0;
+}
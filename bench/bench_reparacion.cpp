@@ -0,0 +1,134 @@
+// Benchmark de la evaluación de hijos: evaluaciones por segundo de la
+// reparación completa frente a la incremental (delta respecto del padre
+// más parecido) según la densidad del grafo.
+//
+// Cada hijo sale de cruce uniforme + mutación bit-flip sobre dos padres
+// válidos, como en el GA. Se miden dos poblaciones de padres: 'diversa'
+// (conjuntos aleatorios reparados, inicio de la corrida) y 'convergida'
+// (variantes de un mismo conjunto, fase final de la corrida). También se
+// verifica que ambas reparaciones coincidan bit a bit.
+//
+// Uso: ./bench/bench_reparacion [n] [p_mut] [p_cruce]
+
+#include "Operadores.h"
+#include "comun.h"
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+using namespace std;
+using namespace bench;
+
+namespace {
+
+const int NUM_PADRES = 32;
+const int NUM_HIJOS = 256;
+
+struct Caso {
+    vector<uint64_t> padres;    // NUM_PADRES filas de num_palabras
+    vector<int> fitness;
+    vector<uint64_t> hijos;     // NUM_HIJOS filas sin reparar
+    vector<int> padre1, padre2; // índices de los padres de cada hijo
+};
+
+Caso prepararCaso(const Grafo& grafo, bool convergida, double p_mut, double p_cruce, Rng& gen) {
+    size_t np = (grafo.n + 63) / 64;
+    uint64_t mascara = (grafo.n & 63) ? (1ULL << (grafo.n & 63)) - 1 : ~0ULL;
+    Caso c;
+    c.padres.assign(NUM_PADRES * np, 0);
+    c.fitness.assign(NUM_PADRES, 0);
+
+    vector<uint64_t> base(np);
+    for (uint64_t& x : base) x = gen();
+    base[np - 1] &= mascara;
+    Operadores::reparar(base.data(), np, grafo);
+
+    for (int i = 0; i < NUM_PADRES; ++i) {
+        uint64_t* w = &c.padres[i * np];
+        if (convergida) {
+            memcpy(w, base.data(), np * sizeof(uint64_t));
+            Operadores::mutar(w, grafo.n, 0.01, gen);
+        } else {
+            for (size_t p = 0; p < np; ++p) w[p] = gen();
+            w[np - 1] &= mascara;
+        }
+        c.fitness[i] = Operadores::reparar(w, np, grafo);
+    }
+
+    c.hijos.assign(NUM_HIJOS * np, 0);
+    vector<uint64_t> descarte(np);
+    for (int h = 0; h < NUM_HIJOS; ++h) {
+        int a = gen() % NUM_PADRES, b = gen() % NUM_PADRES;
+        uint64_t* hijo = &c.hijos[h * np];
+        Operadores::cruzar(&c.padres[a * np], &c.padres[b * np], hijo, descarte.data(), np, p_cruce, gen);
+        Operadores::mutar(hijo, grafo.n, p_mut, gen);
+        c.padre1.push_back(a);
+        c.padre2.push_back(b);
+    }
+    return c;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int n = (argc > 1) ? atoi(argv[1]) : 10000;
+    double p_mut = (argc > 2) ? atof(argv[2]) : 0.01;
+    double p_cruce = (argc > 3) ? atof(argv[3]) : 0.9;
+    const int grados[] = {2, 8, 32, 128};
+    size_t np = (n + 63) / 64;
+
+    cout << "# Evaluaciones/s (hijos reparados), n = " << n << ", p_mut = " << p_mut
+         << ", p_cruce = " << p_cruce << endl;
+    cout << setw(12) << "grado_medio" << setw(12) << "padres" << setw(14) << "completa"
+         << setw(14) << "incremental" << setw(10) << "speedup" << setw(12) << "distintos" << endl;
+
+    vector<uint64_t> trabajo(np), esperado(np), pendientes(np, 0);
+    for (int grado : grados) {
+        Grafo grafo = generarErdosRenyi(n, grado, 1);
+        Rng gen(Rng::Tipo::XOSHIRO256, 7);
+
+        for (bool convergida : {false, true}) {
+            Caso c = prepararCaso(grafo, convergida, p_mut, p_cruce, gen);
+
+            // Verificación bit a bit
+            int distintos = 0;
+            for (int h = 0; h < NUM_HIJOS; ++h) {
+                memcpy(esperado.data(), &c.hijos[h * np], np * sizeof(uint64_t));
+                memcpy(trabajo.data(), &c.hijos[h * np], np * sizeof(uint64_t));
+                int fe = Operadores::reparar(esperado.data(), np, grafo);
+                int fi = Operadores::repararDesdePadres(
+                    trabajo.data(), &c.padres[c.padre1[h] * np], c.fitness[c.padre1[h]],
+                    &c.padres[c.padre2[h] * np], c.fitness[c.padre2[h]], np, grafo, pendientes.data());
+                if (fe != fi || esperado != trabajo) distintos++;
+            }
+
+            double ms_completa = medianaMs(5, [&](int) {
+                for (int h = 0; h < NUM_HIJOS; ++h) {
+                    memcpy(trabajo.data(), &c.hijos[h * np], np * sizeof(uint64_t));
+                    Operadores::reparar(trabajo.data(), np, grafo);
+                }
+            });
+            double ms_incremental = medianaMs(5, [&](int) {
+                for (int h = 0; h < NUM_HIJOS; ++h) {
+                    memcpy(trabajo.data(), &c.hijos[h * np], np * sizeof(uint64_t));
+                    Operadores::repararDesdePadres(
+                        trabajo.data(), &c.padres[c.padre1[h] * np], c.fitness[c.padre1[h]],
+                        &c.padres[c.padre2[h] * np], c.fitness[c.padre2[h]], np, grafo, pendientes.data());
+                }
+            });
+
+            double eps_completa = NUM_HIJOS / (ms_completa / 1000.0);
+            double eps_incremental = NUM_HIJOS / (ms_incremental / 1000.0);
+            cout << setw(12) << grado << setw(12) << (convergida ? "convergida" : "diversa")
+                 << setw(14) << fixed << setprecision(0) << eps_completa
+                 << setw(14) << eps_incremental
+                 << setw(10) << setprecision(2) << eps_incremental / eps_completa
+                 << setw(12) << distintos << endl;
+            cout.unsetf(ios::fixed);
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,105 @@
+// Benchmark de los generadores aleatorios (--rng): bits aleatorios por
+// segundo llamando de a una palabra y con llenar(), índices acotados por
+// segundo con acotado() e indices(), y generaciones por segundo de MotorGA
+// con cada motor (la población inicial no cuenta).
+//
+// Uso: ./bench/bench_rng [n] [grado_medio] [generaciones] [pop_size]
+
+#include "MotorGA.h"
+#include "comun.h"
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+using namespace std;
+using namespace bench;
+
+namespace {
+
+const Rng::Tipo TIPOS[] = {Rng::Tipo::MT19937_64, Rng::Tipo::XOSHIRO256, Rng::Tipo::PHILOX4X32};
+const size_t PALABRAS = 1 << 14;  // 128 KiB: cabe en L2
+const int VUELTAS = 256;
+
+// Evita que el compilador descarte lo generado
+volatile uint64_t sumidero;
+
+double gibPorSegundo(double ms) {
+    double bytes = static_cast<double>(PALABRAS) * VUELTAS * sizeof(uint64_t);
+    return bytes / (ms * 1e-3) / (1u << 30);
+}
+
+double millonesPorSegundo(double ms) {
+    return static_cast<double>(PALABRAS) * VUELTAS / (ms * 1e-3) / 1e6;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int n = (argc > 1) ? atoi(argv[1]) : 20000;
+    double grado_medio = (argc > 2) ? atof(argv[2]) : 20.0;
+    int generaciones = (argc > 3) ? atoi(argv[3]) : 200;
+    int pop_size = (argc > 4) ? atoi(argv[4]) : 100;
+
+    vector<uint64_t> palabras(PALABRAS);
+    vector<int> indices(PALABRAS);
+
+    cout << "# Bits aleatorios (GiB/s) e índices en [0, " << pop_size << ") (M/s), "
+         << PALABRAS * VUELTAS << " por medición" << endl;
+    cout << setw(12) << "motor" << setw(12) << "operator()" << setw(10) << "llenar"
+         << setw(12) << "acotado" << setw(10) << "indices" << endl;
+    for (Rng::Tipo tipo : TIPOS) {
+        Rng gen(tipo, 1);
+        double sueltas = medianaMs(5, [&](int) {
+            for (int v = 0; v < VUELTAS; ++v) {
+                for (size_t i = 0; i < PALABRAS; ++i) palabras[i] = gen();
+            }
+            sumidero = palabras[PALABRAS - 1];
+        });
+        double lote = medianaMs(5, [&](int) {
+            for (int v = 0; v < VUELTAS; ++v) gen.llenar(palabras.data(), PALABRAS);
+            sumidero = palabras[PALABRAS - 1];
+        });
+        double acotados = medianaMs(5, [&](int) {
+            for (int v = 0; v < VUELTAS; ++v) {
+                for (size_t i = 0; i < PALABRAS; ++i) indices[i] = static_cast<int>(gen.acotado(pop_size));
+            }
+            sumidero = indices[PALABRAS - 1];
+        });
+        double lote_indices = medianaMs(5, [&](int) {
+            for (int v = 0; v < VUELTAS; ++v) gen.indices(indices.data(), PALABRAS, pop_size);
+            sumidero = indices[PALABRAS - 1];
+        });
+        cout << setw(12) << Rng::nombreTipo(tipo) << fixed << setprecision(2)
+             << setw(12) << gibPorSegundo(sueltas) << setw(10) << gibPorSegundo(lote)
+             << setprecision(0) << setw(12) << millonesPorSegundo(acotados)
+             << setw(10) << millonesPorSegundo(lote_indices) << endl;
+    }
+
+    Grafo grafo = generarErdosRenyi(n, grado_medio, 1);
+    cout << "\n# Generaciones/s de MotorGA, n = " << n << ", m = " << grafo.numAristas()
+         << ", pop_size = " << pop_size << ", " << generaciones << " generaciones, 1 hilo" << endl;
+    cout << setw(12) << "motor" << setw(12) << "p_mut" << setw(10) << "gen/s" << endl;
+    for (double p_mut : {0.001, 0.05}) {
+        for (Rng::Tipo tipo : TIPOS) {
+            ParametrosGA params;
+            params.pop_size = pop_size;
+            params.seeding_rate = 0.0;
+            params.p_mut = p_mut;
+            params.rng = tipo;
+            vector<double> tiempos;
+            for (int r = 0; r < 3; ++r) {
+                MotorGA motor(grafo, params, pop_size, static_cast<uint64_t>(r + 1), 1);
+                motor.inicializar();
+                auto t0 = Clock::now();
+                for (int g = 0; g < generaciones; ++g) motor.generacion();
+                tiempos.push_back(std::chrono::duration<double, std::milli>(Clock::now() - t0).count());
+            }
+            sort(tiempos.begin(), tiempos.end());
+            double ms = tiempos[1];
+            cout << setw(12) << Rng::nombreTipo(tipo) << setw(12) << defaultfloat << p_mut
+                 << setw(10) << fixed << setprecision(1) << generaciones / (ms * 1e-3) << endl;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,83 @@
+// Benchmark del núcleo de reparación: evaluaciones por segundo recorriendo
+// el CSR frente a la matriz de bits (AND de filas con el prefijo reparado)
+// con cada núcleo SIMD, según la densidad del grafo. La columna 'auto'
+// indica qué camino elige Grafo::convieneMatrizBits.
+//
+// Uso: ./bench/bench_simd [n] [p_mut]
+
+#include "Operadores.h"
+#include "comun.h"
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+using namespace std;
+using namespace bench;
+
+int main(int argc, char** argv) {
+    int n = (argc > 1) ? atoi(argv[1]) : 4000;
+    double p_mut = (argc > 2) ? atof(argv[2]) : 0.01;
+    const double densidades[] = {0.001, 0.004, 0.01, 0.02, 0.05, 0.1, 0.3};
+    const int num_padres = 32;
+    const int num_hijos = 256;
+    size_t np = (n + 63) / 64;
+    uint64_t mascara = (n & 63) ? (1ULL << (n & 63)) - 1 : ~0ULL;
+
+    const NucleoSimd nucleos[] = {NucleoSimd::ESCALAR, NucleoSimd::SSE41, NucleoSimd::AVX2};
+    NucleoSimd original = Operadores::nucleoSimd();
+
+    cout << "# Reparaciones/s, n = " << n << ", p_mut = " << p_mut
+         << ", núcleo por defecto: " << Operadores::nombreNucleo(original) << endl;
+    cout << setw(10) << "densidad" << setw(8) << "auto" << setw(12) << "csr";
+    for (NucleoSimd nuc : nucleos) cout << setw(12) << Operadores::nombreNucleo(nuc);
+    cout << endl;
+
+    vector<uint64_t> trabajo(np);
+    for (double densidad : densidades) {
+        Grafo grafo = generarErdosRenyi(n, densidad * (n - 1), 1);
+        bool denso_auto = grafo.tieneMatrizBits();
+        Rng gen(Rng::Tipo::XOSHIRO256, 7);
+
+        // Padres reparados al azar e hijos por cruce + mutación
+        vector<uint64_t> padres(num_padres * np), hijos(num_hijos * np), descarte(np);
+        for (int i = 0; i < num_padres; ++i) {
+            uint64_t* w = &padres[i * np];
+            for (size_t p = 0; p < np; ++p) w[p] = gen();
+            w[np - 1] &= mascara;
+            Operadores::reparar(w, np, grafo);
+        }
+        for (int h = 0; h < num_hijos; ++h) {
+            Operadores::cruzar(&padres[(gen() % num_padres) * np], &padres[(gen() % num_padres) * np],
+                               &hijos[h * np], descarte.data(), np, 1.0, gen);
+            Operadores::mutar(&hijos[h * np], n, p_mut, gen);
+        }
+
+        auto medir = [&]() {
+            double ms = medianaMs(5, [&](int) {
+                for (int h = 0; h < num_hijos; ++h) {
+                    memcpy(trabajo.data(), &hijos[h * np], np * sizeof(uint64_t));
+                    Operadores::reparar(trabajo.data(), np, grafo);
+                }
+            });
+            return num_hijos / (ms / 1000.0);
+        };
+
+        cout << setw(10) << densidad << setw(8) << (denso_auto ? "denso" : "csr");
+        cout << fixed << setprecision(0);
+        grafo.liberarMatrizBits();
+        cout << setw(12) << medir();
+        grafo.construirMatrizBits();
+        for (NucleoSimd nuc : nucleos) {
+            if (Operadores::fijarNucleoSimd(nuc)) cout << setw(12) << medir();
+            else cout << setw(12) << "-";
+        }
+        cout << endl;
+        cout.unsetf(ios::fixed);
+        cout << setprecision(6);
+    }
+    Operadores::fijarNucleoSimd(original);
+
+    return 0;
+}
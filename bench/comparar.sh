@@ -0,0 +1,41 @@
+#!/bin/bash
+
+# Compara dos salidas de bench/bench_operadores (TSV) y marca regresiones
+#
+# Uso: bench/comparar.sh <base.tsv> <nuevo.tsv> [umbral]
+#   umbral: aumento relativo de la mediana que cuenta como regresión
+#           (default 0.10 = 10%). Para no confundir ruido con regresiones,
+#           además se exige que la mediana nueva supere el p90 de la base.
+# Sale con código 1 si hay alguna regresión.
+
+if [ $# -lt 2 ]; then
+    echo "Uso: $0 <base.tsv> <nuevo.tsv> [umbral]"
+    exit 2
+fi
+
+BASE=$1
+NUEVO=$2
+UMBRAL=${3:-0.10}
+
+awk -F'\t' -v umbral="$UMBRAL" '
+    # Filas de datos: operador, n, grado_medio, ..., mediana_us (7), p10 (8), p90 (9)
+    FNR == 1 || /^#/ || $1 == "operador" { next }
+    NR == FNR { clave = $1 FS $2 FS $3; base[clave] = $7; base_p90[clave] = $9; next }
+    {
+        clave = $1 FS $2 FS $3
+        if (!(clave in base)) {
+            printf "%-20s %8s %6s %12s %12.3f %8s  nuevo\n", $1, $2, $3, "-", $7, "-"
+            next
+        }
+        cambio = ($7 - base[clave]) / base[clave]
+        marca = ""
+        if (cambio > umbral && $7 > base_p90[clave]) { marca = "REGRESION"; regresiones++ }
+        else if (cambio < -umbral) marca = "mejora"
+        printf "%-20s %8s %6s %12.3f %12.3f %+7.1f%%  %s\n", $1, $2, $3, base[clave], $7, 100 * cambio, marca
+    }
+    BEGIN { printf "%-20s %8s %6s %12s %12s %8s\n", "operador", "n", "grado", "base_us", "nuevo_us", "cambio" }
+    END {
+        printf "\n%d regresion(es) con umbral %.0f%%\n", regresiones, 100 * umbral
+        exit (regresiones > 0)
+    }
+' "$BASE" "$NUEVO"
@@ -0,0 +1,90 @@
+#ifndef BENCH_COMUN_H
+#define BENCH_COMUN_H
+
+// Utilidades compartidas por los benchmarks de bench/
+
+#include "Grafo.h"
+#include "Rng.h"
+#include <algorithm>
+#include <chrono>
+#include <utility>
+#include <vector>
+
+namespace bench {
+
+using Clock = std::chrono::high_resolution_clock;
+
+/**
+ * @brief Grafo Erdős–Rényi G(n, m) con m = n·grado_medio/2 aristas al azar
+ */
+inline Grafo generarErdosRenyi(int n, double grado_medio, uint64_t semilla) {
+    Rng gen(Rng::Tipo::XOSHIRO256, semilla);
+    long long m = static_cast<long long>(n * grado_medio / 2.0);
+    std::vector<std::pair<int, int>> aristas;
+    aristas.reserve(m);
+    for (long long e = 0; e < m; ++e) {
+        aristas.emplace_back(gen() % n, gen() % n);
+    }
+    Grafo grafo;
+    grafo.construirDesdeAristas(n, aristas);
+    return grafo;
+}
+
+/**
+ * @brief Mediana en milisegundos de 'repeticiones' llamadas a f(r)
+ */
+template <typename F>
+double medianaMs(int repeticiones, F&& f) {
+    std::vector<double> tiempos;
+    for (int r = 0; r < repeticiones; ++r) {
+        auto t0 = Clock::now();
+        f(r);
+        tiempos.push_back(std::chrono::duration<double, std::milli>(Clock::now() - t0).count());
+    }
+    std::sort(tiempos.begin(), tiempos.end());
+    return tiempos[tiempos.size() / 2];
+}
+
+/**
+ * @brief Percentiles de una serie de tiempos
+ */
+struct Estadisticas {
+    double mediana;
+    double p10;
+    double p90;
+    double p99;
+};
+
+/**
+ * @brief Percentil q (0..1) de una serie ordenada, por interpolación lineal
+ */
+inline double percentil(const std::vector<double>& ordenados, double q) {
+    if (ordenados.empty()) return 0.0;
+    double pos = q * (ordenados.size() - 1);
+    size_t i = static_cast<size_t>(pos);
+    if (i + 1 >= ordenados.size()) return ordenados.back();
+    return ordenados[i] + (pos - i) * (ordenados[i + 1] - ordenados[i]);
+}
+
+/**
+ * @brief Mide f(r) 'calentamiento' veces sin registrar y 'repeticiones'
+ *        veces registrando; devuelve percentiles en microsegundos por
+ *        llamada, dividiendo cada repetición por 'lote'
+ */
+template <typename F>
+Estadisticas medirUs(int calentamiento, int repeticiones, int lote, F&& f) {
+    for (int r = 0; r < calentamiento; ++r) f(r);
+    std::vector<double> tiempos;
+    for (int r = 0; r < repeticiones; ++r) {
+        auto t0 = Clock::now();
+        f(r);
+        tiempos.push_back(std::chrono::duration<double, std::micro>(Clock::now() - t0).count() / lote);
+    }
+    std::sort(tiempos.begin(), tiempos.end());
+    return {percentil(tiempos, 0.5), percentil(tiempos, 0.1),
+            percentil(tiempos, 0.9), percentil(tiempos, 0.99)};
+}
+
+} // namespace bench
+
+#endif // BENCH_COMUN_H
@@ -0,0 +1,49 @@
+#!/bin/bash
+
+# Benchmark de escalabilidad con instancias sintéticas (tools/generar_grafo):
+# para cada familia y n = 10^3 .. 10^max_exp corre el GA durante unos
+# segundos con --stats json y reporta carga, generaciones/s y memoria.
+#
+# Uso: bench/escalado.sh [max_exp] [segundos] [grado_medio]
+# Las instancias se generan en un directorio temporal que se borra al final.
+
+MAX_EXP=${1:-5}
+SEGUNDOS=${2:-2}
+GRADO=${3:-8}
+
+RAIZ="$(cd "$(dirname "$0")/.." && pwd)"
+GA="$RAIZ/ga"
+GENERADOR="$RAIZ/tools/generar_grafo"
+
+if [ ! -x "$GA" ] || [ ! -x "$GENERADOR" ]; then
+    echo "Error: compilar primero con 'make' (se necesitan ./ga y tools/generar_grafo)"
+    exit 1
+fi
+
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+# Valor numérico de un campo del registro JSON
+campo() {
+    echo "$1" | grep -o "\"$2\":[^,}]*" | head -1 | cut -d: -f2
+}
+
+# Segundos de carga: "carga_grafo":{"segundos":X,...}
+carga() {
+    echo "$1" | grep -o '"carga_grafo":{"segundos":[^,}]*' | cut -d: -f3
+}
+
+printf "familia\tn\tm\tcarga_s\tgeneraciones_por_s\tevaluaciones_por_s\tcalidad\trss_pico_kb\n"
+for familia in erdos powerlaw geometric grid; do
+    for ((e = 3; e <= MAX_EXP; e++)); do
+        n=$((10 ** e))
+        grafo="$TMP/${familia}_${n}.graph"
+        "$GENERADOR" "$familia" "$n" --grado "$GRADO" --seed 1 -o "$grafo" 2>/dev/null || exit 1
+        stats=$("$GA" -i "$grafo" -t "$SEGUNDOS" --seed 1 --no_cache --stats json 2>&1 >/dev/null | tail -1)
+        printf "%s\t%s\t%s\t%s\t%s\t%s\t%s\t%s\n" "$familia" "$n" \
+            "$(campo "$stats" m)" "$(carga "$stats")" \
+            "$(campo "$stats" generaciones_por_s)" "$(campo "$stats" evaluaciones_por_s)" \
+            "$(campo "$stats" calidad)" "$(campo "$stats" rss_pico_kb)"
+        rm -f "$grafo"
+    done
+done
@@ -1,129 +1,778 @@
 #include "AlgoritmoGenetico.h"
+#include "Checkpoint.h"
+#include "Componentes.h"
+#include "MotorGA.h"
 #include "Operadores.h"
-#include "Greedy.h"
+#include "PoolHilos.h"
+#include "Reordenamiento.h"
+#include "Telemetria.h"
 #include <iostream>
 #include <iomanip>
 #include <chrono>
 #include <random>
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <sstream>
+#include <cstdio>
 
 using namespace std;
 using Clock = chrono::high_resolution_clock;
 
-void AlgoritmoGenetico::inicializarPoblacion(
-    vector<Individuo>& poblacion,
-    const Grafo& grafo,
-    mt19937& gen,
-    int k_greedy,
-    double seeding_rate
-) {
-    int pop_size = poblacion.size();
-    int n = (pop_size > 0) ? poblacion[0].cromosoma.size() : 0;
-    if (n == 0) return;
+namespace {
+
+// Buzón de entrada de una isla, con espacio preasignado para los migrantes
+// de todas sus fuentes. Solo escriben sus vecinas (una vez cada
+// intervalo_migracion generaciones) y la dueña consulta primero el flag
+// atómico, así el mutex casi nunca se disputa.
+struct Buzon {
+    mutex m;
+    Poblacion entrantes;
+    int ocupados = 0;
+    atomic<bool> hay_correo{false};
+
+    Buzon(int capacidad, int n) : entrantes(capacidad, n) {}
+};
+
+// Mejor solución global compartida entre islas
+struct MejorCompartido {
+    atomic<int> fitness{-1};
+    mutex m;
+    Individuo mejor;
 
-    int n_greedy = static_cast<int>(pop_size * seeding_rate);
+    explicit MejorCompartido(int n) : mejor(n) {}
+};
+
+// Suma de los mejores por componente (--components). Cada componente
+// reporta a través de su ReporteComponente; la línea impresa es el total
+// cada vez que alguna mejora.
+struct SumaComponentes {
+    mutex m;
+    ostream& out;
+    int desplazamiento;
+    vector<int> mejor;  // por componente
+    int total = 0;
+
+    SumaComponentes(ostream& out, int desplazamiento, int num_componentes)
+        : out(out), desplazamiento(desplazamiento), mejor(num_componentes, 0) {}
+
+    void actualizar(int c, int fitness, double tiempo) {
+        lock_guard<mutex> lock(m);
+        if (fitness <= mejor[c]) return;
+        total += fitness - mejor[c];
+        mejor[c] = fitness;
+        out << "Calidad: " << total + desplazamiento
+            << ", Tiempo: " << fixed << setprecision(4) << tiempo << endl;
+    }
 
-    // Crear individuos greedy
-    for (int i = 0; i < n_greedy; ++i) {
-        poblacion[i] = Greedy::crearIndividuo(grafo.adj, k_greedy, gen);
+    void reinicio(int c, const string& motivo, double tiempo) {
+        lock_guard<mutex> lock(m);
+        out << "Reinicio (componente " << c << ", " << motivo << "), Tiempo: "
+            << fixed << setprecision(4) << tiempo << endl;
     }
+};
 
-    // Crear individuos aleatorios
-    uniform_int_distribution<> dis_bit(0, 1);
-    for (int i = n_greedy; i < pop_size; ++i) {
-        for (int j = 0; j < n; ++j) {
-            poblacion[i].cromosoma[j] = (dis_bit(gen) == 1);
+class ReporteComponente : public ReporteAnytime {
+public:
+    ReporteComponente(SumaComponentes& suma, int c)
+        : ReporteAnytime(suma.out, suma.desplazamiento), suma(suma), c(c) {}
+
+    void inicial(int fitness, double tiempo) override { suma.actualizar(c, fitness, tiempo); }
+    void mejora(int fitness, double tiempo) override { suma.actualizar(c, fitness, tiempo); }
+    void reinicio(const string& motivo, double tiempo) override { suma.reinicio(c, motivo, tiempo); }
+
+private:
+    SumaComponentes& suma;
+    int c;
+};
+
+// Cadena JSON con las comillas, barras y controles escapados
+string textoJson(const string& s) {
+    string r = "\"";
+    for (char c : s) {
+        if (c == '"' || c == '\\') {
+            r += '\\';
+            r += c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            char buf[8];
+            snprintf(buf, sizeof(buf), "\\u%04x", c);
+            r += buf;
+        } else {
+            r += c;
         }
-        Operadores::reparar_y_evaluar(poblacion[i], grafo.adj);
     }
+    return r + "\"";
+}
+
+// Registro único de --stats json: parámetros, resultado, ritmo, memoria y
+// tiempo por fase (sumado sobre hilos)
+void escribirEstadisticasJson(
+    ostream& out,
+    const ParametrosGA& params,
+    const Grafo& grafo,
+    const ResultadoGA& resultado
+) {
+    double t = resultado.tiempo_total > 0 ? resultado.tiempo_total : 1e-9;
+    ostringstream js;
+    js << setprecision(6);
+    js << "{\"instancia\":" << textoJson(params.instancia)
+       << ",\"n\":" << grafo.n
+       << ",\"m\":" << grafo.numAristas()
+       << ",\"seed\":" << params.seed
+       << ",\"pop_size\":" << params.pop_size
+       << ",\"hilos\":" << params.num_hilos
+       << ",\"islas\":" << params.num_islas
+       << ",\"orden\":\"" << Reordenamiento::nombre(params.orden) << "\""
+       << ",\"busqueda_local\":" << (params.busqueda_local ? "true" : "false")
+       << ",\"calidad\":" << resultado.mejor.fitness
+       << ",\"tiempo_total\":" << resultado.tiempo_total
+       << ",\"generaciones\":" << resultado.generaciones
+       << ",\"evaluaciones\":" << resultado.evaluaciones
+       << ",\"generaciones_por_s\":" << resultado.generaciones / t
+       << ",\"evaluaciones_por_s\":" << resultado.evaluaciones / t
+       << ",\"rss_pico_kb\":" << Telemetria::rssPicoKb()
+       << ",\"reduccion\":";
+    if (resultado.reducido) {
+        const Reduccion::Estadisticas& r = resultado.reduccion;
+        js << "{\"n_kernel\":" << r.nodos_kernel
+           << ",\"m_kernel\":" << r.aristas_kernel
+           << ",\"desplazamiento\":" << r.desplazamiento
+           << ",\"segundos\":" << resultado.tiempo_reduccion << "}";
+    } else {
+        js << "null";
+    }
+    js << ",\"cache_evaluaciones\":";
+    if (resultado.cache.entradas > 0) {
+        const EstadisticasCache& c = resultado.cache;
+        js << "{\"entradas\":" << c.entradas
+           << ",\"consultas\":" << c.consultas
+           << ",\"aciertos_padre\":" << c.aciertos_padre
+           << ",\"aciertos\":" << c.aciertos
+           << ",\"pausadas\":" << c.pausadas
+           << ",\"tasa_aciertos\":" << c.tasaAciertos()
+           << ",\"segundos_reparacion\":" << c.segundos_reparacion
+           << ",\"segundos_cache\":" << c.segundos_cache
+           << ",\"segundos_ahorrados\":" << c.segundosAhorrados() << "}";
+    } else {
+        js << "null";
+    }
+    js << ",\"diversidad\":";
+    if (resultado.diversidad.mediciones > 0) {
+        const EstadisticasDiversidad& d = resultado.diversidad;
+        js << "{\"media\":" << d.distanciaMedia()
+           << ",\"minima\":" << d.minima
+           << ",\"final\":" << d.ultima.distancia
+           << ",\"convergencia_final\":" << d.ultima.convergencia
+           << ",\"reinicios\":" << d.reinicios << "}";
+    } else {
+        js << "null";
+    }
+    js << ",\"componentes\":";
+    if (resultado.componentes > 0) {
+        js << "{\"total\":" << resultado.componentes
+           << ",\"exactas\":" << resultado.componentes_exactas << "}";
+    } else {
+        js << "null";
+    }
+    js << ",\"telemetria\":" << (Telemetria::compilada ? "true" : "false")
+       << ",\"fases\":{";
+    for (int f = 0; f < static_cast<int>(Fase::NUM_FASES); ++f) {
+        Telemetria::ResumenFase r = Telemetria::resumen(static_cast<Fase>(f));
+        js << (f ? "," : "") << "\"" << Telemetria::nombreFase(static_cast<Fase>(f)) << "\":"
+           << "{\"segundos\":" << r.segundos << ",\"llamadas\":" << r.llamadas << "}";
+    }
+    js << "}}";
+    out << js.str() << endl;
+}
+
+// Flujo de la semilla reservado a la permutación de --order random (los
+// hilos e islas usan los flujos 1, 2, ...)
+const uint64_t SEMILLA_ORDEN = 0x6f7264656eULL;
+
+uint64_t semillaBase(const ParametrosGA& params) {
+    return (params.seed >= 0) ? static_cast<uint64_t>(params.seed)  // Seed fija (reproducible)
+                              : random_device{}();                   // Seed aleatoria (no reproducible)
 }
 
-void AlgoritmoGenetico::ejecutar(const ParametrosGA& params) {
+} // namespace
+
+bool AlgoritmoGenetico::ejecutar(const ParametrosGA& params) {
+    Telemetria::activar(params.stats_json);
+
     // Cargar grafo
     Grafo grafo;
-    if (!grafo.cargarDesdeArchivo(params.instancia)) {
-        return;
+    {
+        CronometroFases crono;
+        bool cargado = params.usar_cache ? grafo.cargarConCache(params.instancia)
+                                         : grafo.cargarDesdeArchivo(params.instancia);
+        if (!cargado) {
+            return false;
+        }
+        crono.marcar(Fase::CARGA_GRAFO);
     }
 
-    // Inicio del algoritmo
-    auto start_time = Clock::now();
-    
-    // Configuración del generador aleatorio con seed configurable
-    mt19937 gen;
-    if (params.seed >= 0) {
-        gen.seed(params.seed);  // Seed fija (reproducible)
+    ResultadoGA resultado = resolver(grafo, params, cout);
+    if (!resultado.error.empty()) {
+        cerr << "Error: " << resultado.error << endl;
+        return false;
+    }
+    if (resultado.reducido) {
+        const Reduccion::Estadisticas& r = resultado.reduccion;
+        cerr << "Kernel: " << r.nodos_kernel << "/" << r.nodos_original << " nodos, "
+             << r.aristas_kernel << "/" << r.aristas_original << " aristas, "
+             << r.desplazamiento << " vértices fijados, "
+             << fixed << setprecision(4) << resultado.tiempo_reduccion << "s" << endl;
+    }
+
+    if (resultado.cache.entradas > 0) {
+        const EstadisticasCache& c = resultado.cache;
+        cerr << "Cache de evaluaciones: " << fixed << setprecision(1) << 100.0 * c.tasaAciertos()
+             << "% aciertos (" << c.aciertos_padre << " copias de un padre, " << c.aciertos
+             << " de la cache, " << c.consultas << " hijos), "
+             << setprecision(4) << c.segundosAhorrados() << "s ahorrados" << endl;
+    }
+    if (PoliticaReinicio(params).activa()) {
+        const EstadisticasDiversidad& d = resultado.diversidad;
+        cerr << "Reinicios: " << d.reinicios << " (diversidad media " << fixed << setprecision(4)
+             << d.distanciaMedia() << ", final " << d.ultima.distancia << ")" << endl;
+    }
+    if (resultado.componentes > 0) {
+        cerr << "Componentes: " << resultado.componentes << " ("
+             << resultado.componentes_exactas << " exactas)" << endl;
+    }
+
+   // Reporte final: CON calidad y tiempo
+    reportarFinal(cout, resultado);
+
+    // Telemetría por stderr: la salida estándar queda igual para irace
+    if (params.stats_json) {
+        escribirEstadisticasJson(cerr, params, grafo, resultado);
+    }
+    return true;
+}
+
+void ReporteAnytime::inicial(int fitness, double tiempo) {
+    out << "Calidad Solucion inicial: " << fitness + desplazamiento
+        << ", Tiempo: " << fixed << setprecision(4) << tiempo << "s" << endl;
+}
+
+void ReporteAnytime::mejora(int fitness, double tiempo) {
+    out << "Calidad: " << fitness + desplazamiento
+        << ", Tiempo: " << fixed << setprecision(4) << tiempo << endl;
+}
+
+void ReporteAnytime::reinicio(const string& motivo, double tiempo) {
+    out << "Reinicio (" << motivo << "), Tiempo: " << fixed << setprecision(4) << tiempo << endl;
+}
+
+void AlgoritmoGenetico::reportarFinal(ostream& out, const ResultadoGA& resultado) {
+    out << "Calidad: " << resultado.mejor.fitness;
+    out << ", Tiempo: " << fixed << setprecision(4) << resultado.tiempo_total << "s" << endl;
+}
+
+ResultadoGA AlgoritmoGenetico::resolver(
+    const Grafo& grafo,
+    const ParametrosGA& params,
+    ostream& out
+) {
+    if (!params.reducir) return despachar(grafo, params, out, 0, 0.0);
+
+    // Kernelización: el GA trabaja sobre el kernel y la mejor solución se
+    // lleva de vuelta al grafo original al final
+    auto inicio = Clock::now();
+    unique_ptr<Reduccion> reduccion;
+    {
+        CronometroFases crono;
+        reduccion.reset(new Reduccion(grafo));
+        crono.marcar(Fase::REDUCCION);
+    }
+    double tiempo_reduccion = chrono::duration<double>(Clock::now() - inicio).count();
+    const Grafo& kernel = reduccion->kernel();
+    int desplazamiento = reduccion->desplazamiento();
+
+    ResultadoGA resultado;
+    if (kernel.n == 0) {
+        // La reducción resolvió el grafo entero
+        out << "Calidad Solucion inicial: " << desplazamiento
+            << ", Tiempo: " << fixed << setprecision(4) << tiempo_reduccion << "s" << endl;
+        resultado.tiempo_total = tiempo_reduccion;
     } else {
-        gen.seed(random_device{}());  // Seed aleatoria (no reproducible)
+        resultado = despachar(kernel, params, out, desplazamiento, tiempo_reduccion);
     }
+    if (!resultado.error.empty()) return resultado;
+
+    Individuo mejor(grafo.n);
+    mejor.fitness = reduccion->reconstruir(resultado.mejor.cromosoma.datos(), mejor.cromosoma);
+    resultado.mejor = mejor;
+    resultado.reducido = true;
+    resultado.reduccion = reduccion->estadisticas();
+    resultado.tiempo_reduccion = tiempo_reduccion;
+    return resultado;
+}
+
+ResultadoGA AlgoritmoGenetico::despachar(
+    const Grafo& grafo,
+    const ParametrosGA& params,
+    ostream& out,
+    int desplazamiento,
+    double tiempo_previo
+) {
+    if (params.orden != OrdenVertices::ORIGINAL) {
+        // El GA ve el grafo renumerado; la mejor solución vuelve a los ids
+        // de entrada
+        auto inicio = Clock::now();
+        Grafo reordenado;
+        vector<int> nuevo_id;
+        {
+            CronometroFases crono;
+            uint64_t semilla = Rng::derivarSemilla(semillaBase(params), SEMILLA_ORDEN);
+            nuevo_id = Reordenamiento::permutacion(grafo, params.orden, semilla);
+            reordenado = Reordenamiento::aplicar(grafo, nuevo_id);
+            crono.marcar(Fase::REORDEN);
+        }
+        // params.orden sigue puesto: el checkpoint lo registra
+        double tiempo_orden = chrono::duration<double>(Clock::now() - inicio).count();
+        ResultadoGA resultado = elegirModelo(reordenado, params, out, desplazamiento,
+                                             tiempo_previo + tiempo_orden);
+        if (!resultado.error.empty()) return resultado;
 
-    // Crear población inicial
-    vector<Individuo> poblacion;
-    for (int i = 0; i < params.pop_size; ++i) {
-        poblacion.push_back(Individuo(grafo.n));
+        Individuo mejor(grafo.n);
+        for (int u = 0; u < grafo.n; ++u) {
+            if (resultado.mejor.cromosoma[nuevo_id[u]]) mejor.cromosoma[u] = true;
+        }
+        mejor.fitness = resultado.mejor.fitness;
+        resultado.mejor = mejor;
+        return resultado;
     }
+    return elegirModelo(grafo, params, out, desplazamiento, tiempo_previo);
+}
+
+ResultadoGA AlgoritmoGenetico::elegirModelo(
+    const Grafo& grafo,
+    const ParametrosGA& params,
+    ostream& out,
+    int desplazamiento,
+    double tiempo_previo
+) {
+    if (params.componentes) return resolverComponentes(grafo, params, out, desplazamiento, tiempo_previo);
+    ReporteAnytime reporte(out, desplazamiento);
+    return (params.num_islas > 1) ? resolverIslas(grafo, params, reporte, tiempo_previo)
+                                  : resolverPoblacion(grafo, params, reporte, tiempo_previo);
+}
+
+ResultadoGA AlgoritmoGenetico::resolverPoblacion(
+    const Grafo& grafo,
+    const ParametrosGA& params,
+    ReporteAnytime& reporte,
+    double tiempo_previo
+) {
+    ResultadoGA resultado;
+
+    // Inicio del algoritmo (el tiempo previo es el de la reducción)
+    auto start_time = Clock::now() - chrono::duration_cast<Clock::duration>(
+                                          chrono::duration<double>(tiempo_previo));
     
-    inicializarPoblacion(poblacion, grafo, gen, params.k_greedy, params.seeding_rate);
+    // Generadores: el hilo 0 usa la semilla tal cual; los demás hilos
+    // reciben flujos derivados de ella, así seed + número de hilos
+    // reproducen la corrida.
+    MotorGA motor(grafo, params, params.pop_size, semillaBase(params), max(1, params.num_hilos));
+    Individuo mejor_solucion_global(grafo.n);
+
+    // La diversidad se mide si hay política de reinicio o telemetría
+    PoliticaReinicio reinicios(params);
+    bool medir_diversidad = reinicios.activa() || params.stats_json;
+    string motivo;
 
-    // Encontrar la mejor solución inicial
-    Individuo mejor_solucion_global = Operadores::obtenerMejor(poblacion);
+    if (!params.reanudar.empty()) {
+        // Continuar un checkpoint: el reloj arranca en el tiempo ya corrido
+        EstadoGA estado;
+        if (!Checkpoint::leer(params.reanudar, estado, resultado.error) ||
+            !motor.restaurarEstado(estado, resultado.error)) {
+            return resultado;
+        }
+        copy(estado.mejor.begin(), estado.mejor.end(), mejor_solucion_global.cromosoma.datos());
+        mejor_solucion_global.fitness = estado.fitness_mejor;
+        start_time = Clock::now() - chrono::duration_cast<Clock::duration>(
+                                        chrono::duration<double>(estado.tiempo));
+
+        reporte.mejora(mejor_solucion_global.fitness, estado.tiempo);
+        reinicios.mejora(estado.tiempo);
+    } else {
+        motor.inicializar();
+
+        // Encontrar la mejor solución inicial
+        motor.poblacion().exportar(motor.indiceMejor(), mejor_solucion_global);
     
-    // Primera solución (comentado para output limpio)
-    auto init_end_time = Clock::now();
-    double elapsed_init = chrono::duration<double>(init_end_time - start_time).count();
+        // Primera solución (comentado para output limpio)
+        auto init_end_time = Clock::now();
+        double elapsed_init = chrono::duration<double>(init_end_time - start_time).count();
+
+        // Primera solución (ahora usa la variable correcta 'elapsed_init')
+        reporte.inicial(mejor_solucion_global.fitness, elapsed_init);
+        reinicios.mejora(elapsed_init);
+    }
+
+    // Checkpoints en segundo plano: el bucle solo copia el estado
+    unique_ptr<EscritorCheckpoint> escritor;
+    if (!params.checkpoint.empty()) escritor.reset(new EscritorCheckpoint(params.checkpoint));
+    auto capturar = [&](EstadoGA& estado, double tiempo) {
+        motor.guardarEstado(estado);
+        estado.tiempo = tiempo;
+        const uint64_t* mejor = mejor_solucion_global.cromosoma.datos();
+        estado.mejor.assign(mejor, mejor + mejor_solucion_global.cromosoma.numPalabras());
+        estado.fitness_mejor = mejor_solucion_global.fitness;
+    };
+    double proximo_checkpoint = chrono::duration<double>(Clock::now() - start_time).count()
+                              + params.checkpoint_cada;
 
-    // Primera solución (ahora usa la variable correcta 'elapsed_init')
-    cout << "Calidad Solucion inicial: " << mejor_solucion_global.fitness 
-         << ", Tiempo: " << fixed << setprecision(4) << elapsed_init << "s" << endl;
+    // Modelo estacionario: las mejoras se reportan al insertar el hijo,
+    // sin esperar al fin de la generación
+    motor.alMejorar([&](int fila) {
+        const Poblacion& poblacion = motor.poblacion();
+        if (poblacion.fitness(fila) <= mejor_solucion_global.fitness) return;
+        double ahora = chrono::duration<double>(Clock::now() - start_time).count();
+        poblacion.exportar(fila, mejor_solucion_global);
+        reporte.mejora(mejor_solucion_global.fitness, ahora);
+        reinicios.mejora(ahora);
+    });
     
     // Bucle principal del GA
+    CronometroFases crono;
     while (true) {
         auto current_time = Clock::now();
         double elapsed_total = chrono::duration<double>(current_time - start_time).count();
         if (elapsed_total >= params.max_time) break;
+        if (params.max_generaciones >= 0 && motor.generaciones() >= params.max_generaciones) break;
 
-        // Lógica de una generación
-        vector<Individuo> nueva_poblacion;
-        nueva_poblacion.reserve(params.pop_size);
-        while (nueva_poblacion.size() < static_cast<size_t>(params.pop_size)) {
-            // Selección
-            Individuo padre1 = Operadores::seleccionPorTorneo(poblacion, gen);
-            Individuo padre2 = Operadores::seleccionPorTorneo(poblacion, gen);
-
-            // Cruce
-            pair<Individuo, Individuo> hijos = 
-                Operadores::cruceUniforme(padre1, padre2, params.p_cruce, gen);
-
-            // Mutación
-            Operadores::mutacionBitFlip(hijos.first, params.p_mut, gen);
-            Operadores::mutacionBitFlip(hijos.second, params.p_mut, gen);
-
-            // Evaluación
-            Operadores::reparar_y_evaluar(hijos.first, grafo.adj);
-            Operadores::reparar_y_evaluar(hijos.second, grafo.adj);
-
-            nueva_poblacion.push_back(hijos.first);
-            if (nueva_poblacion.size() < static_cast<size_t>(params.pop_size)) {
-                nueva_poblacion.push_back(hijos.second);
+        // Lógica de una generación (reemplazo generacional incluido)
+        motor.generacion();
+
+        // Reporte any-time (comentado para output limpio)
+        crono.reiniciar();
+        const Poblacion& poblacion = motor.poblacion();
+        int idx_mejor = motor.indiceMejor();
+        if (poblacion.fitness(idx_mejor) > mejor_solucion_global.fitness) {
+            poblacion.exportar(idx_mejor, mejor_solucion_global);
+            reporte.mejora(mejor_solucion_global.fitness, elapsed_total);
+            reinicios.mejora(elapsed_total);
+        }
+        crono.marcar(Fase::MEJOR);
+
+        // Diversidad y reinicio (la élite sobrevive, el resto se vuelve a sembrar)
+        if (medir_diversidad) {
+            MedidaDiversidad medida = Diversidad::medir(poblacion, motor.generaciones());
+            resultado.diversidad.registrar(medida);
+            crono.marcar(Fase::DIVERSIDAD);
+            if (reinicios.evaluar(medida, motor.generaciones(), elapsed_total, motivo)) {
+                motor.reiniciar(params.reinicio_elite);
+                resultado.diversidad.reinicios++;
+                reporte.reinicio(motivo, elapsed_total);
             }
         }
-        
-        // Reemplazo generacional
-        std::swap(poblacion, nueva_poblacion);
-        nueva_poblacion.clear();
 
-        // Reporte any-time (comentado para output limpio)
-        Individuo mejor_generacion = Operadores::obtenerMejor(poblacion);
-        if (mejor_generacion.fitness > mejor_solucion_global.fitness) {
-            mejor_solucion_global = mejor_generacion;
-            
-             cout << "Calidad: " << mejor_solucion_global.fitness;
-             cout << ", Tiempo: " << fixed << setprecision(4) << elapsed_total << endl;
+        // Si la escritura anterior sigue en curso, se reintenta en la
+        // próxima generación en vez de esperarla
+        if (escritor && elapsed_total >= proximo_checkpoint && escritor->libre()) {
+            capturar(escritor->instantanea(), elapsed_total);
+            escritor->publicar();
+            proximo_checkpoint = elapsed_total + params.checkpoint_cada;
         }
     }
     
-   // Reporte final: CON calidad y tiempo
     auto final_time = Clock::now();
-    double final_elapsed = chrono::duration<double>(final_time - start_time).count();
+    resultado.tiempo_total = chrono::duration<double>(final_time - start_time).count();
+
+    // Checkpoint final: permite continuar la corrida con más presupuesto
+    if (escritor) {
+        escritor->esperar();
+        capturar(escritor->instantanea(), resultado.tiempo_total);
+        escritor->publicar();
+        if (!escritor->esperar()) {
+            cerr << "Advertencia: No se pudo escribir el checkpoint " << params.checkpoint << endl;
+        }
+    }
+    resultado.generaciones = motor.generaciones();
+    resultado.evaluaciones = motor.evaluaciones();
+    resultado.cache = motor.estadisticasCache();
+    resultado.mejor = mejor_solucion_global;
+    return resultado;
+}
+
+ResultadoGA AlgoritmoGenetico::resolverIslas(
+    const Grafo& grafo,
+    const ParametrosGA& params,
+    ReporteAnytime& reporte,
+    double tiempo_previo
+) {
+    ResultadoGA resultado;
+    auto start_time = Clock::now() - chrono::duration_cast<Clock::duration>(
+                                          chrono::duration<double>(tiempo_previo));
+
+    int num_islas = params.num_islas;
+    int tam_isla = max(2, params.pop_size / num_islas);
+    int intervalo = max(1, params.intervalo_migracion);
+    int migrantes = max(1, min(params.num_migrantes, tam_isla));
+
+    // Destinos de migración según la topología
+    vector<vector<int>> destinos(num_islas);
+    for (int i = 0; i < num_islas; ++i) {
+        if (params.topologia == TopologiaIslas::ANILLO) {
+            destinos[i].push_back((i + 1) % num_islas);
+        } else {
+            for (int j = 0; j < num_islas; ++j) {
+                if (j != i) destinos[i].push_back(j);
+            }
+        }
+    }
+    int fuentes_por_isla = (params.topologia == TopologiaIslas::ANILLO) ? 1 : num_islas - 1;
+
+    // Cada isla es un motor de un hilo con su propio flujo aleatorio
+    uint64_t semilla = semillaBase(params);
+    vector<unique_ptr<MotorGA>> islas;
+    vector<unique_ptr<Buzon>> buzones;
+    for (int i = 0; i < num_islas; ++i) {
+        uint64_t semilla_isla = (i == 0) ? semilla : Rng::derivarSemilla(semilla, i);
+        islas.emplace_back(new MotorGA(grafo, params, tam_isla, semilla_isla, 1));
+        buzones.emplace_back(new Buzon(migrantes * fuentes_por_isla, grafo.n));
+    }
+    MejorCompartido global(grafo.n);
+    vector<EstadisticasDiversidad> diversidad(num_islas);
+
+    PoolHilos pool(num_islas);
+
+    // Inicialización de todas las islas en paralelo
+    pool.ejecutar([&](int isla) { islas[isla]->inicializar(); });
+
+    for (const unique_ptr<MotorGA>& isla : islas) {
+        const Poblacion& poblacion = isla->poblacion();
+        int idx = isla->indiceMejor();
+        if (poblacion.fitness(idx) > global.mejor.fitness) poblacion.exportar(idx, global.mejor);
+    }
+    global.fitness = global.mejor.fitness;
+
+    double elapsed_init = chrono::duration<double>(Clock::now() - start_time).count();
+    reporte.inicial(global.mejor.fitness, elapsed_init);
+
+    pool.ejecutar([&](int isla) {
+        MotorGA& motor = *islas[isla];
+        Poblacion& poblacion = motor.poblacion();
+        vector<int> indices(tam_isla);
+        CronometroFases crono;
+
+        // Cada isla decide sus reinicios según su propio mejor
+        PoliticaReinicio reinicios(params);
+        bool medir_diversidad = reinicios.activa() || params.stats_json;
+        int mejor_isla = poblacion.fitness(motor.indiceMejor());
+        reinicios.mejora(elapsed_init);
+        string motivo;
 
-    cout << "Calidad: " << mejor_solucion_global.fitness;
-    cout << ", Tiempo: " << fixed << setprecision(4) << final_elapsed << "s" << endl;
+        // Reporte any-time contra el mejor global compartido
+        auto registrarMejor = [&](int fila, double tiempo) {
+            int fitness = poblacion.fitness(fila);
+            if (fitness > global.fitness.load(memory_order_relaxed)) {
+                lock_guard<mutex> lock(global.m);
+                if (fitness > global.mejor.fitness) {
+                    poblacion.exportar(fila, global.mejor);
+                    global.fitness.store(global.mejor.fitness, memory_order_relaxed);
+                    reporte.mejora(global.mejor.fitness, tiempo);
+                }
+            }
+            if (fitness > mejor_isla) {
+                mejor_isla = fitness;
+                reinicios.mejora(tiempo);
+            }
+        };
+        motor.alMejorar([&](int fila) {
+            registrarMejor(fila, chrono::duration<double>(Clock::now() - start_time).count());
+        });
+
+        while (true) {
+            double elapsed_total = chrono::duration<double>(Clock::now() - start_time).count();
+            if (elapsed_total >= params.max_time) break;
+            if (params.max_generaciones >= 0 && motor.generaciones() >= params.max_generaciones) break;
+
+            motor.generacion();
+
+            crono.reiniciar();
+            registrarMejor(motor.indiceMejor(), elapsed_total);
+            crono.marcar(Fase::MEJOR);
+
+            if (medir_diversidad) {
+                MedidaDiversidad medida = Diversidad::medir(poblacion, motor.generaciones());
+                diversidad[isla].registrar(medida);
+                crono.marcar(Fase::DIVERSIDAD);
+                if (reinicios.evaluar(medida, motor.generaciones(), elapsed_total, motivo)) {
+                    motor.reiniciar(params.reinicio_elite);
+                    diversidad[isla].reinicios++;
+                    lock_guard<mutex> lock(global.m);
+                    reporte.reinicio("isla " + to_string(isla) + ", " + motivo, elapsed_total);
+                }
+            }
+
+            // Emigración: copias de los mejores hacia las islas destino. Si
+            // el buzón está lleno, el migrante pisa al peor de los pendientes.
+            if (motor.generaciones() % intervalo == 0) {
+                iota(indices.begin(), indices.end(), 0);
+                partial_sort(indices.begin(), indices.begin() + migrantes, indices.end(),
+                             [&](int a, int b) { return poblacion.fitness(a) > poblacion.fitness(b); });
+                for (int d : destinos[isla]) {
+                    Buzon& buzon = *buzones[d];
+                    lock_guard<mutex> lock(buzon.m);
+                    for (int r = 0; r < migrantes; ++r) {
+                        int fila = buzon.ocupados;
+                        if (fila < buzon.entrantes.tamano()) {
+                            buzon.ocupados++;
+                        } else {
+                            fila = buzon.entrantes.indicePeor();
+                            if (buzon.entrantes.fitness(fila) >= poblacion.fitness(indices[r])) continue;
+                        }
+                        buzon.entrantes.copiarDesde(fila, poblacion, indices[r]);
+                    }
+                    buzon.hay_correo.store(true, memory_order_release);
+                }
+            }
+
+            // Inmigración: los recibidos reemplazan a los peores si son mejores
+            Buzon& propio = *buzones[isla];
+            if (propio.hay_correo.load(memory_order_acquire)) {
+                lock_guard<mutex> lock(propio.m);
+                for (int r = 0; r < propio.ocupados; ++r) {
+                    int idx_peor = motor.indicePeor();
+                    if (propio.entrantes.fitness(r) > poblacion.fitness(idx_peor)) {
+                        motor.reemplazar(idx_peor, propio.entrantes, r);
+                    }
+                }
+                propio.ocupados = 0;
+                propio.hay_correo.store(false, memory_order_relaxed);
+            }
+            crono.marcar(Fase::MIGRACION);
+        }
+    });
+
+    for (const unique_ptr<MotorGA>& isla : islas) {
+        resultado.generaciones += isla->generaciones();
+        resultado.evaluaciones += isla->evaluaciones();
+        resultado.cache.sumar(isla->estadisticasCache());
+    }
+    for (const EstadisticasDiversidad& d : diversidad) resultado.diversidad.sumar(d);
+    resultado.tiempo_total = chrono::duration<double>(Clock::now() - start_time).count();
+    resultado.mejor = global.mejor;
+    return resultado;
+}
+
+ResultadoGA AlgoritmoGenetico::resolverComponentes(
+    const Grafo& grafo,
+    const ParametrosGA& params,
+    ostream& out,
+    int desplazamiento,
+    double tiempo_previo
+) {
+    auto start_time = Clock::now() - chrono::duration_cast<Clock::duration>(
+                                          chrono::duration<double>(tiempo_previo));
+    vector<Componentes::Componente> componentes;
+    {
+        CronometroFases crono;
+        componentes = Componentes::separar(grafo);
+        crono.marcar(Fase::COMPONENTES);
+    }
+
+    ResultadoGA resultado;
+    if (componentes.empty()) {
+        // Grafo conexo: una sola corrida sobre el grafo tal cual
+        ReporteAnytime reporte(out, desplazamiento);
+        resultado = resolverPoblacion(grafo, params, reporte, tiempo_previo);
+        resultado.componentes = 1;
+        return resultado;
+    }
+    int num_componentes = static_cast<int>(componentes.size());
+    SumaComponentes suma(out, desplazamiento, num_componentes);
+
+    // Las chicas se resuelven ya; las grandes arrancan con una solución
+    // maximal (todo en 1 y reparado) para que el total inicial sea útil
+    Individuo mejor(grafo.n);
+    vector<int> grandes;
+    vector<Individuo> iniciales;  // por componente grande
+    for (int c = 0; c < num_componentes; ++c) {
+        const Componentes::Componente& comp = componentes[c];
+        if (comp.grafo.n <= Componentes::TAM_EXACTO) {
+            uint64_t solucion = 0;
+            suma.mejor[c] = Componentes::resolverExacto(comp.grafo, solucion);
+            for (int u = 0; u < comp.grafo.n; ++u) {
+                if ((solucion >> u) & 1ULL) mejor.cromosoma[comp.nodos[u]] = true;
+            }
+            resultado.componentes_exactas++;
+        } else {
+            Individuo inicial(comp.grafo.n);
+            Cromosoma& bits = inicial.cromosoma;
+            fill(bits.datos(), bits.datos() + bits.numPalabras(), ~0ULL);
+            bits.datos()[bits.numPalabras() - 1] &= bits.mascaraUltima();
+            inicial.fitness = Operadores::reparar(bits.datos(), bits.numPalabras(), comp.grafo);
+            suma.mejor[c] = inicial.fitness;
+            iniciales.push_back(inicial);
+            grandes.push_back(c);
+        }
+        suma.total += suma.mejor[c];
+    }
+    resultado.componentes = num_componentes;
+
+    double elapsed_init = chrono::duration<double>(Clock::now() - start_time).count();
+    out << "Calidad Solucion inicial: " << suma.total + desplazamiento
+        << ", Tiempo: " << fixed << setprecision(4) << elapsed_init << "s" << endl;
+
+    // Reparto de mayor a menor al hilo con menos nodos asignados
+    int num_hilos = max(1, min(params.num_hilos, static_cast<int>(grandes.size())));
+    vector<vector<int>> asignadas(num_hilos);
+    vector<long long> carga(num_hilos, 0);
+    for (int c : grandes) {
+        int h = static_cast<int>(min_element(carga.begin(), carga.end()) - carga.begin());
+        asignadas[h].push_back(c);
+        carga[h] += componentes[c].grafo.n;
+    }
+
+    vector<ResultadoGA> resultados(num_componentes);
+    if (!grandes.empty()) {
+        PoolHilos pool(num_hilos);
+        pool.ejecutar([&](int h) {
+            long long restante = carga[h];
+            for (int c : asignadas[h]) {
+                const Componentes::Componente& comp = componentes[c];
+                double ahora = chrono::duration<double>(Clock::now() - start_time).count();
+                double presupuesto = max(0.0, params.max_time - ahora) * comp.grafo.n / restante;
+                restante -= comp.grafo.n;
+
+                ParametrosGA params_comp = params;
+                params_comp.num_hilos = 1;
+                params_comp.max_time = ahora + presupuesto;
+                if (params.seed >= 0) {
+                    params_comp.seed = static_cast<int>(
+                        Rng::derivarSemilla(static_cast<uint64_t>(params.seed), c) & 0x7fffffff);
+                }
+                ReporteComponente reporte(suma, c);
+                resultados[c] = resolverPoblacion(comp.grafo, params_comp, reporte, ahora);
+            }
+        });
+    }
+
+    // Unión de las soluciones en los ids del grafo (la inicial si el GA no
+    // la superó)
+    for (size_t g = 0; g < grandes.size(); ++g) {
+        int c = grandes[g];
+        const Componentes::Componente& comp = componentes[c];
+        const Individuo& elegido = (resultados[c].mejor.fitness >= iniciales[g].fitness)
+                                   ? resultados[c].mejor : iniciales[g];
+        const Cromosoma& cromosoma = elegido.cromosoma;
+        for (int u = 0; u < comp.grafo.n; ++u) {
+            if (cromosoma[u]) mejor.cromosoma[comp.nodos[u]] = true;
+        }
+        resultado.generaciones += resultados[c].generaciones;
+        resultado.evaluaciones += resultados[c].evaluaciones;
+        resultado.cache.sumar(resultados[c].cache);
+        resultado.diversidad.sumar(resultados[c].diversidad);
+    }
+    mejor.fitness = mejor.cromosoma.contar();
+    resultado.mejor = mejor;
+    resultado.tiempo_total = chrono::duration<double>(Clock::now() - start_time).count();
+    return resultado;
 }
@@ -3,33 +3,68 @@
 
 #include <string>
 #include <vector>
-#include <random>
+#include <ostream>
+#include "CacheEvaluaciones.h"
+#include "Diversidad.h"
 #include "Grafo.h"
 #include "Individuo.h"
+#include "Parametros.h"
+#include "Reduccion.h"
+#include "Rng.h"
 
 /**
- * @brief Parámetros del algoritmo genético
+ * @brief Resultado de una corrida del algoritmo genético
  */
-struct ParametrosGA {
-    std::string instancia;
-    double max_time;
-    int pop_size;
-    double p_cruce;
-    double p_mut;
-    int k_greedy;
-    double seeding_rate;
-    int seed;  // -1 = aleatorio, >= 0 = fija
-
-    // Valores por defecto
-    ParametrosGA() 
-        : instancia(""),
-          max_time(10.0),
-          pop_size(100),
-          p_cruce(0.9),
-          p_mut(0.01),
-          k_greedy(10),
-          seeding_rate(0.2),
-          seed(-1) {}
+struct ResultadoGA {
+    Individuo mejor;
+    long long generaciones;
+    long long evaluaciones;
+    double tiempo_total;
+    std::string error;  // no vacío si la corrida no pudo empezar (p. ej. --resume inválido)
+    bool reducido;      // el GA corrió sobre el kernel (--reduce)
+    Reduccion::Estadisticas reduccion;
+    double tiempo_reduccion;
+    int componentes;          // componentes conexas (0 = sin --components)
+    int componentes_exactas;  // resueltas por ramificación
+    EstadisticasCache cache;  // --eval_cache, sumada sobre motores
+    EstadisticasDiversidad diversidad;  // con reinicios o --stats json
+
+    ResultadoGA()
+        : mejor(0), generaciones(0), evaluaciones(0), tiempo_total(0.0),
+          reducido(false), tiempo_reduccion(0.0), componentes(0), componentes_exactas(0) {}
+};
+
+/**
+ * @brief Destino de las líneas any-time de una corrida
+ *
+ * El básico escribe en un flujo sumando los vértices que ya fijó la
+ * reducción; con --components cada componente tiene uno propio que
+ * reporta la suma de los mejores de todas.
+ */
+class ReporteAnytime {
+public:
+    ReporteAnytime(std::ostream& out, int desplazamiento)
+        : out(out), desplazamiento(desplazamiento) {}
+    virtual ~ReporteAnytime() = default;
+
+    /**
+     * @brief "Calidad Solucion inicial: X, Tiempo: Ys"
+     */
+    virtual void inicial(int fitness, double tiempo);
+
+    /**
+     * @brief "Calidad: X, Tiempo: Y" (una mejora del mejor global)
+     */
+    virtual void mejora(int fitness, double tiempo);
+
+    /**
+     * @brief "Reinicio (motivo), Tiempo: Y" (la población se volvió a sembrar)
+     */
+    virtual void reinicio(const std::string& motivo, double tiempo);
+
+protected:
+    std::ostream& out;
+    int desplazamiento;
 };
 
 /**
@@ -40,19 +75,108 @@ public:
     /**
      * @brief Ejecuta el algoritmo genético para MISP
      * @param params Parámetros del algoritmo
+     * @return false si no se pudo cargar el grafo o reanudar la corrida
      */
-    static void ejecutar(const ParametrosGA& params);
+    static bool ejecutar(const ParametrosGA& params);
+
+    /**
+     * @brief Corre el GA sobre un grafo ya cargado
+     *
+     * Escribe en 'out' la solución inicial y cada mejora ("Calidad: X,
+     * Tiempo: Y"); la línea final la escribe ejecutar(). Con --resume
+     * continúa la corrida del checkpoint (el tiempo y las generaciones
+     * previas cuentan para -t y --max_gens); con --checkpoint guarda el
+     * estado cada checkpoint_cada segundos y al terminar. Con --reduce el
+     * GA corre sobre el kernel y 'mejor' se devuelve en los ids originales;
+     * las calidades reportadas son siempre las del grafo original. Con
+     * --components cada componente conexa se resuelve por separado.
+     * @param grafo Grafo de la instancia
+     * @param params Parámetros del algoritmo
+     * @param out Flujo para el reporte any-time
+     * @return Mejor solución y contadores de la corrida
+     */
+    static ResultadoGA resolver(
+        const Grafo& grafo,
+        const ParametrosGA& params,
+        std::ostream& out
+    );
+
+    /**
+     * @brief Escribe la línea final ("Calidad: X, Tiempo: Ys")
+     */
+    static void reportarFinal(std::ostream& out, const ResultadoGA& resultado);
 
 private:
     /**
-     * @brief Inicializa la población con seeding
+     * @brief Renumera según --order y elige el modelo
+     *
+     * Con --order corre sobre una copia renumerada del grafo y devuelve
+     * 'mejor' con los ids de 'grafo'.
+     * Las calidades se reportan sumando 'desplazamiento' (vértices que ya
+     * fijó la reducción) y los tiempos contando 'tiempo_previo'.
+     */
+    static ResultadoGA despachar(
+        const Grafo& grafo,
+        const ParametrosGA& params,
+        std::ostream& out,
+        int desplazamiento,
+        double tiempo_previo
+    );
+
+    /**
+     * @brief Elige el modelo (componentes, islas o población única) sobre
+     *        'grafo' tal como está (ya renumerado si params.orden lo pide)
+     */
+    static ResultadoGA elegirModelo(
+        const Grafo& grafo,
+        const ParametrosGA& params,
+        std::ostream& out,
+        int desplazamiento,
+        double tiempo_previo
+    );
+
+    /**
+     * @brief Población única (con --threads para la descendencia)
+     */
+    static ResultadoGA resolverPoblacion(
+        const Grafo& grafo,
+        const ParametrosGA& params,
+        ReporteAnytime& reporte,
+        double tiempo_previo
+    );
+
+    /**
+     * @brief Modelo de islas: K subpoblaciones, un hilo por isla
+     *
+     * Cada isla es un MotorGA de pop_size / K individuos y cada
+     * intervalo_migracion generaciones deja copias de sus mejores
+     * individuos en los buzones (preasignados) de sus vecinas; al
+     * recibirlos reemplazan a los peores si son mejores. El mejor global
+     * se comparte entre islas para el reporte any-time.
+     */
+    static ResultadoGA resolverIslas(
+        const Grafo& grafo,
+        const ParametrosGA& params,
+        ReporteAnytime& reporte,
+        double tiempo_previo
+    );
+
+    /**
+     * @brief Una corrida independiente por componente conexa
+     *
+     * Las componentes de hasta Componentes::TAM_EXACTO nodos se resuelven
+     * de forma exacta; las demás reparten --threads hilos (cada una es un
+     * GA de un hilo, asignadas de mayor a menor al hilo menos cargado) y
+     * cada una recibe una parte del tiempo que le queda a su hilo
+     * proporcional a su tamaño. El reporte any-time es la suma de los
+     * mejores de todas las componentes.
      */
-    static void inicializarPoblacion(
-        std::vector<Individuo>& poblacion,
+    static ResultadoGA resolverComponentes(
         const Grafo& grafo,
-        std::mt19937& gen,
-        int k_greedy,
-        double seeding_rate
+        const ParametrosGA& params,
+        std::ostream& out,
+        int desplazamiento,
+        double tiempo_previo
     );
 };
 
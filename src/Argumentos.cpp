@@ -0,0 +1,168 @@
+#include "Argumentos.h"
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+ResultadoArgs Argumentos::parsear(
+    const std::vector<std::string>& args,
+    ParametrosGA& params,
+    std::string& error
+) {
+    if (std::find(args.begin(), args.end(), "--bestP") != args.end()) {
+        params.pop_size = 299;
+        params.p_cruce = 0.76;
+        params.p_mut = 0.14;
+        params.k_greedy = 11;
+        params.seeding_rate = 0.44;
+    }
+
+    size_t argc = args.size();
+    try {
+        for (size_t i = 0; i < argc; ++i) {
+            const std::string& arg = args[i];
+
+            if (arg == "-i" && i + 1 < argc) {
+                params.instancia = args[++i];
+            } else if (arg == "-t" && i + 1 < argc) {
+                params.max_time = std::stod(args[++i]);
+            } else if (arg == "--pop_size" && i + 1 < argc) {
+                params.pop_size = std::stoi(args[++i]);
+            } else if (arg == "--p_cruce" && i + 1 < argc) {
+                params.p_cruce = std::stod(args[++i]);
+            } else if (arg == "--p_mut" && i + 1 < argc) {
+                params.p_mut = std::stod(args[++i]);
+            } else if (arg == "--k_greedy" && i + 1 < argc) {
+                params.k_greedy = std::stoi(args[++i]);
+            } else if (arg == "--seeding_rate" && i + 1 < argc) {
+                params.seeding_rate = std::stod(args[++i]);
+            } else if (arg == "--seed" && i + 1 < argc) {
+                params.seed = std::stoi(args[++i]);
+            } else if (arg == "--max_gens" && i + 1 < argc) {
+                params.max_generaciones = std::stoll(args[++i]);
+            } else if (arg == "--rng" && i + 1 < argc) {
+                const std::string& nombre = args[++i];
+                if (!Rng::tipoDesdeNombre(nombre, params.rng)) {
+                    error = "Generador aleatorio desconocido: " + nombre + " (mt19937_64, xoshiro o philox)";
+                    return ResultadoArgs::ERROR;
+                }
+            } else if (arg == "--help" || arg == "-h") {
+                return ResultadoArgs::AYUDA;
+            } else if (arg == "--threads" && i + 1 < argc) {
+                params.num_hilos = std::stoi(args[++i]);
+                if (params.num_hilos <= 0) {
+                    params.num_hilos = std::max(1u, std::thread::hardware_concurrency());
+                }
+            } else if (arg == "--islands" && i + 1 < argc) {
+                params.num_islas = std::max(1, std::stoi(args[++i]));
+            } else if (arg == "--migration_interval" && i + 1 < argc) {
+                params.intervalo_migracion = std::stoi(args[++i]);
+            } else if (arg == "--migrants" && i + 1 < argc) {
+                params.num_migrantes = std::stoi(args[++i]);
+            } else if (arg == "--topology" && i + 1 < argc) {
+                const std::string& topologia = args[++i];
+                if (topologia == "ring") {
+                    params.topologia = TopologiaIslas::ANILLO;
+                } else if (topologia == "full") {
+                    params.topologia = TopologiaIslas::COMPLETA;
+                } else {
+                    error = "Topología desconocida: " + topologia;
+                    return ResultadoArgs::ERROR;
+                }
+            } else if (arg == "--local_search") {
+                params.busqueda_local = true;
+            } else if (arg == "--ls_budget" && i + 1 < argc) {
+                params.presupuesto_bl = std::stod(args[++i]);
+            } else if (arg == "--stats" && i + 1 < argc) {
+                const std::string& formato = args[++i];
+                if (formato != "json") {
+                    error = "Formato de estadísticas desconocido: " + formato;
+                    return ResultadoArgs::ERROR;
+                }
+                params.stats_json = true;
+            } else if (arg == "--reduce") {
+                params.reducir = true;
+            } else if (arg == "--order" && i + 1 < argc) {
+                const std::string& orden = args[++i];
+                if (orden == "original") {
+                    params.orden = OrdenVertices::ORIGINAL;
+                } else if (orden == "degree") {
+                    params.orden = OrdenVertices::GRADO;
+                } else if (orden == "rcm") {
+                    params.orden = OrdenVertices::RCM;
+                } else if (orden == "random") {
+                    params.orden = OrdenVertices::ALEATORIO;
+                } else {
+                    error = "Orden de vértices desconocido: " + orden;
+                    return ResultadoArgs::ERROR;
+                }
+            } else if (arg == "--model" && i + 1 < argc) {
+                const std::string& modelo = args[++i];
+                if (modelo == "generational") {
+                    params.modelo = ModeloGA::GENERACIONAL;
+                } else if (modelo == "steady") {
+                    params.modelo = ModeloGA::ESTACIONARIO;
+                } else {
+                    error = "Modelo desconocido: " + modelo;
+                    return ResultadoArgs::ERROR;
+                }
+            } else if (arg == "--eval_cache" && i + 1 < argc) {
+                params.cache_evaluaciones = std::max(0, std::stoi(args[++i]));
+            } else if (arg == "--restart_diversity" && i + 1 < argc) {
+                params.reinicio_diversidad = std::stod(args[++i]);
+            } else if (arg == "--restart_stagnation" && i + 1 < argc) {
+                params.reinicio_estancamiento = std::stod(args[++i]);
+            } else if (arg == "--restart_elite" && i + 1 < argc) {
+                params.reinicio_elite = std::max(0, std::stoi(args[++i]));
+            } else if (arg == "--components") {
+                params.componentes = true;
+            } else if (arg == "--checkpoint" && i + 1 < argc) {
+                params.checkpoint = args[++i];
+            } else if (arg == "--checkpoint_every" && i + 1 < argc) {
+                params.checkpoint_cada = std::stod(args[++i]);
+            } else if (arg == "--resume" && i + 1 < argc) {
+                params.reanudar = args[++i];
+            } else if (arg == "--no_cache") {
+                params.usar_cache = false;
+            }
+        }
+    } catch (const std::exception&) {
+        error = "Valor numérico inválido en las opciones";
+        return ResultadoArgs::ERROR;
+    }
+
+    if ((!params.checkpoint.empty() || !params.reanudar.empty()) && params.num_islas > 1) {
+        error = "--checkpoint y --resume no están disponibles con --islands";
+        return ResultadoArgs::ERROR;
+    }
+    if (params.orden == OrdenVertices::ALEATORIO && params.seed < 0 &&
+        (!params.checkpoint.empty() || !params.reanudar.empty())) {
+        error = "--order random con --checkpoint o --resume requiere --seed";
+        return ResultadoArgs::ERROR;
+    }
+    if (params.componentes && (!params.checkpoint.empty() || !params.reanudar.empty() ||
+                               params.num_islas > 1)) {
+        error = "--components no se combina con --checkpoint, --resume ni --islands";
+        return ResultadoArgs::ERROR;
+    }
+
+    return ResultadoArgs::OK;
+}
+
+std::vector<std::string> Argumentos::separar(const std::string& linea) {
+    std::vector<std::string> palabras;
+    std::istringstream in(linea);
+    std::string palabra;
+    while (in >> palabra) palabras.push_back(palabra);
+    return palabras;
+}
+
+std::string Argumentos::buscarOpcion(
+    const std::vector<std::string>& args,
+    const std::vector<std::string>& opciones
+) {
+    for (const std::string& arg : args) {
+        if (std::find(opciones.begin(), opciones.end(), arg) != opciones.end()) return arg;
+    }
+    return "";
+}
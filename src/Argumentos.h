@@ -0,0 +1,57 @@
+#ifndef ARGUMENTOS_H
+#define ARGUMENTOS_H
+
+#include <string>
+#include <vector>
+#include "Parametros.h"
+
+/**
+ * @brief Resultado de interpretar una lista de opciones
+ */
+enum class ResultadoArgs {
+    OK,
+    AYUDA,   // se pidió -h / --help
+    ERROR
+};
+
+/**
+ * @brief Interpretación de las opciones del GA
+ *
+ * La usan la línea de comandos, las líneas del manifiesto de --batch y
+ * los pedidos de --serve, así una corrida se describe igual en los tres.
+ */
+class Argumentos {
+public:
+    /**
+     * @brief Aplica las opciones de 'args' sobre 'params'
+     *
+     * --bestP se aplica antes que el resto, así las demás opciones pueden
+     * sobrescribir sus valores. Las opciones que no son del GA se ignoran.
+     * @param args Opciones (sin el nombre del programa)
+     * @param params Parámetros a completar
+     * @param error Mensaje si el resultado es ERROR
+     */
+    static ResultadoArgs parsear(
+        const std::vector<std::string>& args,
+        ParametrosGA& params,
+        std::string& error
+    );
+
+    /**
+     * @brief Separa una línea en palabras (espacios y tabs)
+     */
+    static std::vector<std::string> separar(const std::string& linea);
+
+    /**
+     * @brief Primera de 'opciones' que aparece en 'args', o "" si ninguna
+     *
+     * Para rechazar en --batch y --serve las opciones que tocan archivos
+     * o procesos del servidor.
+     */
+    static std::string buscarOpcion(
+        const std::vector<std::string>& args,
+        const std::vector<std::string>& opciones
+    );
+};
+
+#endif // ARGUMENTOS_H
@@ -0,0 +1,207 @@
+#include "BusquedaLocal.h"
+#include <algorithm>
+
+BusquedaLocal::BusquedaLocal(const Grafo& grafo)
+    : grafo(grafo),
+      w(nullptr),
+      costo(0),
+      tight(grafo.n, 0),
+      pos_libre(grafo.n, -1),
+      en_cola(grafo.n, 0),
+      marca(grafo.n, 0),
+      sello(0),
+      cursor(0),
+      salio(grafo.n, 0) {
+    libres.reserve(grafo.n);
+    cola.reserve(grafo.n);
+    candidatos.reserve(grafo.n);
+    salidos.reserve(grafo.n);
+}
+
+void BusquedaLocal::agregarLibre(int v) {
+    if (pos_libre[v] != -1) return;
+    pos_libre[v] = static_cast<int>(libres.size());
+    libres.push_back(v);
+}
+
+void BusquedaLocal::quitarLibre(int v) {
+    int p = pos_libre[v];
+    if (p == -1) return;
+    int ultimo = libres.back();
+    libres[p] = ultimo;
+    pos_libre[ultimo] = p;
+    libres.pop_back();
+    pos_libre[v] = -1;
+}
+
+void BusquedaLocal::encolar(int v) {
+    if (en_cola[v]) return;
+    en_cola[v] = 1;
+    cola.push_back(v);
+}
+
+void BusquedaLocal::insertar(int v) {
+    w[v >> 6] |= 1ULL << (v & 63);
+    quitarLibre(v);
+    encolar(v);
+    Grafo::Vecinos lista = grafo.vecinosDe(v);
+    costo += lista.size();
+    for (int y : lista) {
+        if (++tight[y] == 1) quitarLibre(y);
+    }
+}
+
+void BusquedaLocal::quitar(int x) {
+    w[x >> 6] &= ~(1ULL << (x & 63));
+    Grafo::Vecinos lista = grafo.vecinosDe(x);
+    costo += lista.size();
+    if (tight[x] == 0) agregarLibre(x);
+    for (int y : lista) {
+        int t = --tight[y];
+        if (t == 0) {
+            agregarLibre(y);
+        } else if (t == 1) {
+            // y pasa a ser 1-tight: su único vecino en la solución gana un
+            // candidato para un (1,2)-swap
+            Grafo::Vecinos vy = grafo.vecinosDe(y);
+            for (const int* it = vy.begin(); it != vy.end(); ++it) {
+                if (enSolucion(*it)) {
+                    costo += it - vy.begin() + 1;
+                    encolar(*it);
+                    break;
+                }
+            }
+        }
+    }
+}
+
+int BusquedaLocal::insertarLibres() {
+    int insertados = 0;
+    while (!libres.empty()) {
+        insertar(libres.back());
+        insertados++;
+    }
+    return insertados;
+}
+
+bool BusquedaLocal::buscarSwap(int x, int& u1, int& u2) {
+    candidatos.clear();
+    Grafo::Vecinos lista = grafo.vecinosDe(x);
+    costo += lista.size();
+    for (int y : lista) {
+        if (tight[y] == 1) candidatos.push_back(y);
+    }
+    size_t k = candidatos.size();
+    if (k < 2) return false;
+
+    if (sello > ~0u - 2) {
+        std::fill(marca.begin(), marca.end(), 0u);
+        sello = 0;
+    }
+
+    // u tiene un compañero no adyacente en 'candidatos' si tiene menos de
+    // k - 1 vecinos marcados
+    unsigned sello_candidatos = ++sello;
+    for (int c : candidatos) marca[c] = sello_candidatos;
+    for (int u : candidatos) {
+        Grafo::Vecinos vu = grafo.vecinosDe(u);
+        costo += vu.size();
+        size_t adyacentes = 0;
+        for (int v : vu) adyacentes += (marca[v] == sello_candidatos);
+        if (adyacentes + 1 >= k) continue;
+
+        unsigned sello_u = ++sello;
+        for (int v : vu) marca[v] = sello_u;
+        for (int c : candidatos) {
+            if (c != u && marca[c] != sello_u) {
+                u1 = u;
+                u2 = c;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+bool BusquedaLocal::unoSwap() {
+    for (; cursor < grafo.n; ++cursor) {
+        int u = cursor;
+        costo++;
+        if (tight[u] != 1 || salio[u] || enSolucion(u)) continue;
+
+        // El único vecino de u en la solución
+        Grafo::Vecinos vu = grafo.vecinosDe(u);
+        for (const int* it = vu.begin(); it != vu.end(); ++it) {
+            if (!enSolucion(*it)) continue;
+            int x = *it;
+            costo += it - vu.begin() + 1;
+            if (!salio[x]) salidos.push_back(x);
+            salio[x] = 1;
+            quitar(x);
+            insertar(u);
+            ++cursor;
+            return true;
+        }
+    }
+    return false;
+}
+
+int BusquedaLocal::mejorar(uint64_t* palabras, int fitness, long long& presupuesto) {
+    if (presupuesto <= 0 || grafo.n == 0) return fitness;
+    w = palabras;
+    costo = grafo.n;
+    cursor = 0;
+
+    // Tightness y lista de libres a partir de la solución
+    std::fill(tight.begin(), tight.end(), 0);
+    size_t num_palabras = (static_cast<size_t>(grafo.n) + 63) / 64;
+    for (size_t p = 0; p < num_palabras; ++p) {
+        uint64_t activos = w[p];
+        while (activos) {
+            int u = static_cast<int>(p * 64 + __builtin_ctzll(activos));
+            activos &= activos - 1;
+            Grafo::Vecinos lista = grafo.vecinosDe(u);
+            costo += lista.size();
+            for (int y : lista) tight[y]++;
+            encolar(u);
+        }
+    }
+    for (int v = 0; v < grafo.n; ++v) {
+        if (tight[v] == 0 && !enSolucion(v)) agregarLibre(v);
+    }
+    fitness += insertarLibres();
+
+    // (1,2)-swaps hasta que ningún vértice de la solución admita uno; ahí
+    // un 1-swap y se vuelve a revisar lo que cambió
+    while (costo < presupuesto) {
+        if (cola.empty()) {
+            if (!unoSwap()) break;
+            fitness += insertarLibres();
+            continue;
+        }
+        int x = cola.back();
+        cola.pop_back();
+        en_cola[x] = 0;
+        if (!enSolucion(x)) continue;
+
+        int u1, u2;
+        if (!buscarSwap(x, u1, u2)) continue;
+        quitar(x);
+        insertar(u1);
+        insertar(u2);
+        fitness += 1 + insertarLibres();
+    }
+
+    // Dejar el estado limpio para la próxima llamada
+    for (int v : cola) en_cola[v] = 0;
+    cola.clear();
+    for (int v : salidos) salio[v] = 0;
+    salidos.clear();
+    presupuesto -= costo;
+    w = nullptr;
+    return fitness;
+}
+
+void BusquedaLocal::mejorar(Individuo& ind, long long& presupuesto) {
+    ind.fitness = mejorar(ind.cromosoma.datos(), ind.fitness, presupuesto);
+}
@@ -0,0 +1,78 @@
+#ifndef BUSQUEDA_LOCAL_H
+#define BUSQUEDA_LOCAL_H
+
+#include <cstdint>
+#include <vector>
+#include "Grafo.h"
+#include "Individuo.h"
+
+/**
+ * @brief Búsqueda local ARW (Andrade, Resende y Werneck) para conjuntos
+ *        independientes
+ *
+ * Mantiene para cada vértice fuera de la solución su "tightness" (cantidad
+ * de vecinos en la solución) y una lista de vértices libres (tightness 0).
+ * Los libres se insertan directamente; un (1,2)-swap saca un vértice x y
+ * mete dos vecinos 1-tight de x no adyacentes entre sí. Evaluar un x
+ * cuesta O(grado) y aplicar un movimiento, O(suma de grados tocados).
+ *
+ * En un óptimo local de esos movimientos se hacen 1-swaps (sacar x, meter
+ * un vecino u 1-tight de x): no cambian el tamaño pero cambian qué
+ * vértices son 1-tight, y pueden habilitar nuevos (1,2)-swaps. Para no
+ * ciclar, un vértice que salió por un 1-swap no vuelve a entrar por otro
+ * en la misma llamada, y cada vértice es destino de un 1-swap a lo sumo
+ * una vez (una pasada por los ids).
+ *
+ * Guarda su estado en buffers de tamaño n reservados al construirla, así
+ * que mejorar() no asigna memoria. Cada hilo necesita su propia instancia.
+ */
+class BusquedaLocal {
+public:
+    explicit BusquedaLocal(const Grafo& grafo);
+
+    /**
+     * @brief Mejora un conjunto independiente hasta un óptimo local o
+     *        hasta agotar el presupuesto
+     *
+     * El resultado siempre es un conjunto independiente, aunque el
+     * presupuesto se agote a mitad de camino.
+     * @param w Palabras del cromosoma (modificadas in-place)
+     * @param fitness Tamaño actual del conjunto
+     * @param presupuesto Vecinos que se pueden visitar; se descuenta lo usado
+     * @return Tamaño del conjunto mejorado
+     */
+    int mejorar(uint64_t* w, int fitness, long long& presupuesto);
+
+    /**
+     * @brief Mejora un individuo válido (ver mejorar sobre palabras)
+     */
+    void mejorar(Individuo& ind, long long& presupuesto);
+
+private:
+    bool enSolucion(int v) const { return (w[v >> 6] >> (v & 63)) & 1ULL; }
+    void agregarLibre(int v);
+    void quitarLibre(int v);
+    void encolar(int v);
+    void insertar(int v);
+    void quitar(int x);
+    int insertarLibres();
+    bool buscarSwap(int x, int& u1, int& u2);
+    bool unoSwap();
+
+    const Grafo& grafo;
+    uint64_t* w;
+    long long costo;
+    std::vector<int> tight;       // vecinos en la solución
+    std::vector<int> libres;      // fuera de la solución con tight 0
+    std::vector<int> pos_libre;   // posición en 'libres' o -1
+    std::vector<int> cola;        // vértices de la solución por revisar (pila)
+    std::vector<char> en_cola;
+    std::vector<int> candidatos;  // vecinos 1-tight del vértice revisado
+    std::vector<unsigned> marca;
+    unsigned sello;
+    int cursor;                   // próximo destino de 1-swap a mirar
+    std::vector<char> salio;      // sacado por un 1-swap en esta llamada
+    std::vector<int> salidos;     // para limpiar 'salio' al terminar
+};
+
+#endif // BUSQUEDA_LOCAL_H
@@ -0,0 +1,58 @@
+#include "CacheEvaluaciones.h"
+#include <cstring>
+
+void EstadisticasCache::sumar(const EstadisticasCache& otra) {
+    entradas += otra.entradas;
+    consultas += otra.consultas;
+    aciertos_padre += otra.aciertos_padre;
+    aciertos += otra.aciertos;
+    pausadas += otra.pausadas;
+    segundos_reparacion += otra.segundos_reparacion;
+    segundos_cache += otra.segundos_cache;
+}
+
+double EstadisticasCache::segundosAhorrados() const {
+    if (fallos() <= 0) return -segundos_cache;
+    double costo_reparacion = segundos_reparacion / fallos();
+    return (aciertos_padre + aciertos) * costo_reparacion - segundos_cache;
+}
+
+CacheEvaluaciones::CacheEvaluaciones(size_t entradas, size_t num_palabras)
+    : num_palabras(num_palabras), cerrojos(NUM_CERROJOS) {
+    size_t capacidad = 1;
+    while (capacidad * 2 <= entradas) capacidad *= 2;
+    size_t bytes_ranura = 2 * num_palabras * sizeof(uint64_t);
+    while (capacidad > 1 && capacidad * bytes_ranura > MAX_BYTES) capacidad /= 2;
+    if (entradas == 0) capacidad = 0;
+
+    ranuras.resize(capacidad);
+    originales.assign(capacidad * num_palabras, 0);
+    reparados.assign(capacidad * num_palabras, 0);
+}
+
+bool CacheEvaluaciones::buscar(uint64_t clave, uint64_t* w, int& fitness, uint64_t& hash_reparado) {
+    if (ranuras.empty()) return false;
+    size_t r = clave & (ranuras.size() - 1);
+    std::lock_guard<std::mutex> lock(cerrojos[r % NUM_CERROJOS]);
+    const Ranura& ranura = ranuras[r];
+    const size_t bytes = num_palabras * sizeof(uint64_t);
+    if (ranura.fitness < 0 || ranura.clave != clave ||
+        std::memcmp(originales.data() + r * num_palabras, w, bytes) != 0) {
+        return false;
+    }
+    std::memcpy(w, reparados.data() + r * num_palabras, bytes);
+    fitness = ranura.fitness;
+    hash_reparado = ranura.hash_reparado;
+    return true;
+}
+
+void CacheEvaluaciones::insertar(uint64_t clave, const uint64_t* original, const uint64_t* reparado,
+                                 int fitness, uint64_t hash_reparado) {
+    if (ranuras.empty()) return;
+    size_t r = clave & (ranuras.size() - 1);
+    std::lock_guard<std::mutex> lock(cerrojos[r % NUM_CERROJOS]);
+    const size_t bytes = num_palabras * sizeof(uint64_t);
+    std::memcpy(originales.data() + r * num_palabras, original, bytes);
+    std::memcpy(reparados.data() + r * num_palabras, reparado, bytes);
+    ranuras[r] = {clave, hash_reparado, fitness};
+}
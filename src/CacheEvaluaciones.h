@@ -0,0 +1,91 @@
+#ifndef CACHE_EVALUACIONES_H
+#define CACHE_EVALUACIONES_H
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+/**
+ * @brief Contadores de la cache de evaluaciones (--eval_cache)
+ */
+struct EstadisticasCache {
+    size_t entradas = 0;              // capacidad (0 = sin cache)
+    long long consultas = 0;          // hijos evaluados con la cache activa
+    long long aciertos_padre = 0;     // hijo idéntico a un padre: ya era válido
+    long long aciertos = 0;           // reparación tomada de la cache
+    long long pausadas = 0;           // hijos de generaciones con la cache apagada por pocos aciertos
+    double segundos_reparacion = 0.0; // reparaciones hechas (estimado por muestreo)
+    double segundos_cache = 0.0;      // consultas, inserciones y hash de los reparados (ídem)
+
+    void sumar(const EstadisticasCache& otra);
+
+    long long fallos() const { return consultas - aciertos_padre - aciertos; }
+
+    double tasaAciertos() const {
+        return consultas ? static_cast<double>(aciertos_padre + aciertos) / consultas : 0.0;
+    }
+
+    /**
+     * @brief Reparaciones evitadas por su costo medio, menos el costo de la cache
+     */
+    double segundosAhorrados() const;
+};
+
+/**
+ * @brief Cache acotada de reparaciones indexada por hash Zobrist
+ *
+ * Guarda, para un cromosoma sin reparar, su versión reparada, el fitness y
+ * el hash del reparado. Es de mapeo directo (la ranura es hash mod
+ * capacidad y una inserción pisa lo que hubiera); la memoria se reserva en
+ * el constructor. Cada ranura guarda también el cromosoma original y un
+ * acierto exige que coincida completo, así una colisión de hash nunca
+ * devuelve una reparación ajena: los resultados son los mismos con y sin
+ * cache. Los hilos de un motor la comparten; las ranuras se protegen con
+ * NUM_CERROJOS mutex repartidos por índice.
+ */
+class CacheEvaluaciones {
+public:
+    static constexpr size_t MAX_BYTES = size_t(256) << 20;  // tope de memoria de las filas
+    static constexpr size_t NUM_CERROJOS = 64;
+
+    /**
+     * @param entradas Capacidad pedida; se redondea a potencia de dos hacia
+     *        abajo y se reduce hasta que las filas quepan en MAX_BYTES
+     * @param num_palabras Palabras de cada cromosoma
+     */
+    CacheEvaluaciones(size_t entradas, size_t num_palabras);
+
+    CacheEvaluaciones(const CacheEvaluaciones&) = delete;
+    CacheEvaluaciones& operator=(const CacheEvaluaciones&) = delete;
+
+    size_t capacidad() const { return ranuras.size(); }
+
+    /**
+     * @brief Si w (sin reparar, con hash 'clave') está en la cache, lo
+     *        reemplaza por su reparación
+     * @return true en un acierto (w, fitness y hash_reparado actualizados)
+     */
+    bool buscar(uint64_t clave, uint64_t* w, int& fitness, uint64_t& hash_reparado);
+
+    /**
+     * @brief Registra la reparación de 'original'
+     */
+    void insertar(uint64_t clave, const uint64_t* original, const uint64_t* reparado,
+                  int fitness, uint64_t hash_reparado);
+
+private:
+    struct Ranura {
+        uint64_t clave = 0;
+        uint64_t hash_reparado = 0;
+        int fitness = -1;  // -1 = vacía
+    };
+
+    size_t num_palabras;
+    std::vector<Ranura> ranuras;
+    std::vector<uint64_t> originales;  // una fila por ranura
+    std::vector<uint64_t> reparados;
+    std::vector<std::mutex> cerrojos;
+};
+
+#endif // CACHE_EVALUACIONES_H
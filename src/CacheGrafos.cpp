@@ -0,0 +1,67 @@
+#include "CacheGrafos.h"
+#include <filesystem>
+#include <system_error>
+
+namespace {
+
+// Clave de la tabla: la misma ruta escrita de dos formas es un solo grafo
+std::string rutaCanonica(const std::string& ruta) {
+    std::error_code ec;
+    std::filesystem::path p = std::filesystem::weakly_canonical(ruta, ec);
+    return ec ? ruta : p.string();
+}
+
+bool marcaArchivo(const std::string& ruta, uint64_t& tam, int64_t& mtime) {
+    std::error_code ec;
+    tam = std::filesystem::file_size(ruta, ec);
+    if (ec) return false;
+    auto t = std::filesystem::last_write_time(ruta, ec);
+    if (ec) return false;
+    mtime = static_cast<int64_t>(t.time_since_epoch().count());
+    return true;
+}
+
+} // namespace
+
+std::shared_ptr<const Grafo> CacheGrafos::obtener(const std::string& ruta, bool usar_cache) {
+    std::string clave = rutaCanonica(ruta);
+    uint64_t tam = 0;
+    int64_t mtime = 0;
+    if (!marcaArchivo(clave, tam, mtime)) return nullptr;
+
+    std::promise<std::shared_ptr<const Grafo>> promesa;
+    std::shared_future<std::shared_ptr<const Grafo>> futuro;
+    bool cargar = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = entradas.find(clave);
+        if (it != entradas.end() && it->second.tam == tam && it->second.mtime == mtime) {
+            futuro = it->second.grafo;
+        } else {
+            futuro = promesa.get_future().share();
+            entradas[clave] = Entrada{tam, mtime, futuro};
+            cargar = true;
+        }
+    }
+    if (!cargar) return futuro.get();
+
+    // La carga ocurre fuera del mutex: otros archivos no esperan a este
+    std::shared_ptr<Grafo> grafo = std::make_shared<Grafo>();
+    bool cargado = usar_cache ? grafo->cargarConCache(ruta) : grafo->cargarDesdeArchivo(ruta);
+    if (!cargado) {
+        grafo.reset();
+        // Un fallo no queda en la tabla: el próximo pedido reintenta
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = entradas.find(clave);
+        if (it != entradas.end() && it->second.tam == tam && it->second.mtime == mtime) {
+            entradas.erase(it);
+        }
+    }
+    promesa.set_value(grafo);
+    return grafo;
+}
+
+size_t CacheGrafos::tamano() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return entradas.size();
+}
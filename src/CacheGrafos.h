@@ -0,0 +1,46 @@
+#ifndef CACHE_GRAFOS_H
+#define CACHE_GRAFOS_H
+
+#include <cstdint>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include "Grafo.h"
+
+/**
+ * @brief Grafos cargados en memoria, compartidos entre corridas
+ *
+ * Cada archivo se carga una sola vez aunque varios hilos lo pidan a la
+ * vez: el primero lo carga y los demás esperan el mismo resultado. Si el
+ * archivo cambia (tamaño o fecha de modificación) se vuelve a cargar; las
+ * corridas que ya tenían la versión anterior la conservan hasta terminar.
+ */
+class CacheGrafos {
+public:
+    /**
+     * @brief Grafo de 'ruta', cargándolo si hace falta
+     * @param ruta Archivo del grafo
+     * @param usar_cache Usar el cache binario '<ruta>.csr' al cargar
+     * @return nullptr si no se pudo cargar
+     */
+    std::shared_ptr<const Grafo> obtener(const std::string& ruta, bool usar_cache);
+
+    /**
+     * @brief Número de grafos en memoria
+     */
+    size_t tamano();
+
+private:
+    struct Entrada {
+        uint64_t tam;
+        int64_t mtime;
+        std::shared_future<std::shared_ptr<const Grafo>> grafo;
+    };
+
+    std::mutex mutex;
+    std::map<std::string, Entrada> entradas;
+};
+
+#endif // CACHE_GRAFOS_H
@@ -0,0 +1,214 @@
+#include "Checkpoint.h"
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <random>
+#include <utility>
+
+namespace {
+
+// Formato binario del checkpoint, little-endian:
+//   EncabezadoCheckpoint | cromosomas[pop_size * num_palabras] (uint64)
+//   | fitness[pop_size] (int32) | mejor[num_palabras] (uint64)
+//   | por hilo: num_palabras_rng (uint64) y sus palabras (uint64)
+const char MAGIA_CHECKPOINT[8] = {'M', 'I', 'S', 'P', 'C', 'K', 'P', '1'};
+const uint32_t VERSION_CHECKPOINT = 2;  // 2: agrega el orden de los vértices
+
+struct EncabezadoCheckpoint {
+    char magia[8];
+    uint32_t version;
+    int32_t tipo_rng;
+    int32_t orden;
+    int32_t reservado;
+    int64_t n;
+    int64_t num_aristas;
+    int64_t pop_size;
+    int64_t num_hilos;
+    int64_t seed;
+    int64_t generaciones;
+    int64_t evaluaciones;
+    double tiempo;
+    int64_t num_palabras;
+    int64_t fitness_mejor;
+};
+
+// Límite de palabras por generador al leer (mt19937_64 usa 313)
+const uint64_t MAX_PALABRAS_RNG = 1024;
+
+template <typename T>
+bool escribirArreglo(FILE* f, const std::vector<T>& v) {
+    return std::fwrite(v.data(), sizeof(T), v.size(), f) == v.size();
+}
+
+template <typename T>
+bool leerArreglo(FILE* f, std::vector<T>& v, size_t tam) {
+    v.resize(tam);
+    return std::fread(v.data(), sizeof(T), tam, f) == tam;
+}
+
+} // namespace
+
+bool Checkpoint::escribir(const std::string& ruta, const EstadoGA& estado) {
+    if (estado.cromosomas.size() != static_cast<size_t>(estado.pop_size) * estado.num_palabras
+        || estado.fitness.size() != static_cast<size_t>(estado.pop_size)
+        || estado.mejor.size() != estado.num_palabras) {
+        return false;
+    }
+
+    EncabezadoCheckpoint enc;
+    std::memcpy(enc.magia, MAGIA_CHECKPOINT, sizeof(enc.magia));
+    enc.version = VERSION_CHECKPOINT;
+    enc.tipo_rng = static_cast<int32_t>(estado.rng);
+    enc.orden = static_cast<int32_t>(estado.orden);
+    enc.reservado = 0;
+    enc.n = estado.n;
+    enc.num_aristas = estado.num_aristas;
+    enc.pop_size = estado.pop_size;
+    enc.num_hilos = static_cast<int64_t>(estado.estados_rng.size());
+    enc.seed = estado.seed;
+    enc.generaciones = estado.generaciones;
+    enc.evaluaciones = estado.evaluaciones;
+    enc.tiempo = estado.tiempo;
+    enc.num_palabras = static_cast<int64_t>(estado.num_palabras);
+    enc.fitness_mejor = estado.fitness_mejor;
+
+    // Temporal y rename: una interrupción durante la escritura deja el
+    // checkpoint anterior intacto
+    std::string temporal = ruta + ".tmp" + std::to_string(std::random_device{}());
+    FILE* f = std::fopen(temporal.c_str(), "wb");
+    if (!f) return false;
+    bool ok = std::fwrite(&enc, sizeof(enc), 1, f) == 1
+           && escribirArreglo(f, estado.cromosomas)
+           && escribirArreglo(f, estado.fitness)
+           && escribirArreglo(f, estado.mejor);
+    for (const std::vector<uint64_t>& palabras : estado.estados_rng) {
+        uint64_t tam = palabras.size();
+        ok = ok && std::fwrite(&tam, sizeof(tam), 1, f) == 1 && escribirArreglo(f, palabras);
+    }
+    ok = (std::fclose(f) == 0) && ok;
+
+    std::error_code ec;
+    if (ok) std::filesystem::rename(temporal, ruta, ec);
+    if (!ok || ec) {
+        std::filesystem::remove(temporal, ec);
+        return false;
+    }
+    return true;
+}
+
+bool Checkpoint::leer(const std::string& ruta, EstadoGA& estado, std::string& error) {
+    FILE* f = std::fopen(ruta.c_str(), "rb");
+    if (!f) {
+        error = "no se pudo abrir " + ruta;
+        return false;
+    }
+
+    EncabezadoCheckpoint enc;
+    bool ok = std::fread(&enc, sizeof(enc), 1, f) == 1
+           && std::memcmp(enc.magia, MAGIA_CHECKPOINT, sizeof(enc.magia)) == 0
+           && enc.version == VERSION_CHECKPOINT;
+    if (!ok) {
+        std::fclose(f);
+        error = ruta + " no es un checkpoint de esta versión";
+        return false;
+    }
+
+    ok = enc.n >= 0 && enc.n < INT32_MAX && enc.pop_size > 0 && enc.pop_size < INT32_MAX
+      && enc.num_hilos > 0 && enc.num_hilos < INT32_MAX
+      && enc.num_palabras == (enc.n + 63) / 64
+      && (enc.tipo_rng == static_cast<int32_t>(Rng::Tipo::MT19937_64)
+          || enc.tipo_rng == static_cast<int32_t>(Rng::Tipo::XOSHIRO256)
+          || enc.tipo_rng == static_cast<int32_t>(Rng::Tipo::PHILOX4X32))
+      && enc.orden >= static_cast<int32_t>(OrdenVertices::ORIGINAL)
+      && enc.orden <= static_cast<int32_t>(OrdenVertices::ALEATORIO);
+    if (ok) {
+        // El tamaño del archivo debe alcanzar para lo que declara el
+        // encabezado antes de reservar nada (con los límites de arriba los
+        // productos no desbordan 64 bits)
+        std::error_code ec;
+        uint64_t tam_archivo = std::filesystem::file_size(ruta, ec);
+        uint64_t pop = static_cast<uint64_t>(enc.pop_size);
+        uint64_t palabras = static_cast<uint64_t>(enc.num_palabras);
+        uint64_t hilos = static_cast<uint64_t>(enc.num_hilos);
+        uint64_t fijo = sizeof(enc) + pop * palabras * sizeof(uint64_t) + pop * sizeof(int32_t)
+                      + palabras * sizeof(uint64_t);
+        ok = !ec && tam_archivo >= fijo
+          && tam_archivo - fijo >= hilos * sizeof(uint64_t)
+          && tam_archivo - fijo <= hilos * (1 + MAX_PALABRAS_RNG) * sizeof(uint64_t);
+    }
+    if (ok) {
+        estado.n = static_cast<int>(enc.n);
+        estado.num_aristas = enc.num_aristas;
+        estado.pop_size = static_cast<int>(enc.pop_size);
+        estado.num_hilos = static_cast<int>(enc.num_hilos);
+        estado.rng = static_cast<Rng::Tipo>(enc.tipo_rng);
+        estado.orden = static_cast<OrdenVertices>(enc.orden);
+        estado.seed = static_cast<int>(enc.seed);
+        estado.generaciones = enc.generaciones;
+        estado.evaluaciones = enc.evaluaciones;
+        estado.tiempo = enc.tiempo;
+        estado.num_palabras = static_cast<size_t>(enc.num_palabras);
+        estado.fitness_mejor = static_cast<int>(enc.fitness_mejor);
+
+        ok = leerArreglo(f, estado.cromosomas, estado.pop_size * estado.num_palabras)
+          && leerArreglo(f, estado.fitness, estado.pop_size)
+          && leerArreglo(f, estado.mejor, estado.num_palabras);
+        estado.estados_rng.resize(estado.num_hilos);
+        for (std::vector<uint64_t>& palabras : estado.estados_rng) {
+            uint64_t tam = 0;
+            ok = ok && std::fread(&tam, sizeof(tam), 1, f) == 1 && tam <= MAX_PALABRAS_RNG
+                    && leerArreglo(f, palabras, tam);
+        }
+    }
+    std::fclose(f);
+    if (!ok) error = ruta + " está truncado o dañado";
+    return ok;
+}
+
+EscritorCheckpoint::EscritorCheckpoint(const std::string& ruta)
+    : ruta(ruta), pendiente(false), terminar(false), hubo_error(false),
+      hilo(&EscritorCheckpoint::bucle, this) {}
+
+EscritorCheckpoint::~EscritorCheckpoint() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        terminar = true;
+    }
+    cv.notify_all();
+    hilo.join();
+}
+
+bool EscritorCheckpoint::libre() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return !pendiente;
+}
+
+void EscritorCheckpoint::publicar() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        std::swap(llenando, escribiendo);
+        pendiente = true;
+    }
+    cv.notify_all();
+}
+
+bool EscritorCheckpoint::esperar() {
+    std::unique_lock<std::mutex> lock(mutex);
+    cv.wait(lock, [this]() { return !pendiente; });
+    return !hubo_error;
+}
+
+void EscritorCheckpoint::bucle() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        cv.wait(lock, [this]() { return pendiente || terminar; });
+        if (!pendiente) return;
+        // 'escribiendo' no se toca desde el GA mientras pendiente == true
+        lock.unlock();
+        bool ok = Checkpoint::escribir(ruta, escribiendo);
+        lock.lock();
+        if (!ok) hubo_error = true;
+        pendiente = false;
+        cv.notify_all();
+    }
+}
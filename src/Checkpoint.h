@@ -0,0 +1,98 @@
+#ifndef CHECKPOINT_H
+#define CHECKPOINT_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Parametros.h"
+#include "Rng.h"
+
+/**
+ * @brief Estado completo de una corrida de población única
+ *
+ * Alcanza para continuar la corrida exactamente donde quedó: población
+ * (cromosomas empaquetados y fitness), mejor solución encontrada,
+ * contadores, tiempo transcurrido y el estado de los generadores de cada
+ * hilo. Los campos de identificación (n, m, pop_size, hilos, rng, seed y
+ * orden de los vértices) se comparan al reanudar.
+ */
+struct EstadoGA {
+    int n = 0;
+    int64_t num_aristas = 0;
+    int pop_size = 0;
+    int num_hilos = 0;
+    Rng::Tipo rng = Rng::Tipo::MT19937_64;
+    int seed = -1;
+    OrdenVertices orden = OrdenVertices::ORIGINAL;  // numeración del grafo de la población
+    long long generaciones = 0;
+    long long evaluaciones = 0;
+    double tiempo = 0.0;                  // segundos transcurridos
+    size_t num_palabras = 0;              // ceil(n / 64)
+    std::vector<uint64_t> cromosomas;     // pop_size filas de num_palabras
+    std::vector<int> fitness;
+    std::vector<uint64_t> mejor;          // num_palabras
+    int fitness_mejor = 0;
+    std::vector<std::vector<uint64_t>> estados_rng;  // uno por hilo
+};
+
+/**
+ * @brief Lectura y escritura de checkpoints binarios
+ */
+class Checkpoint {
+public:
+    /**
+     * @brief Escribe el estado (a un temporal que luego se renombra)
+     */
+    static bool escribir(const std::string& ruta, const EstadoGA& estado);
+
+    /**
+     * @brief Lee un checkpoint
+     * @param error Motivo si falla
+     */
+    static bool leer(const std::string& ruta, EstadoGA& estado, std::string& error);
+};
+
+/**
+ * @brief Escritura de checkpoints en segundo plano con doble buffer
+ *
+ * El bucle del GA llena instantanea() solo si libre() y llama a
+ * publicar(): los buffers se intercambian y un hilo propio escribe el
+ * archivo mientras el GA sigue. Si la escritura anterior no terminó, el
+ * GA no espera; lo intenta de nuevo en la generación siguiente.
+ */
+class EscritorCheckpoint {
+public:
+    explicit EscritorCheckpoint(const std::string& ruta);
+    ~EscritorCheckpoint();
+
+    EscritorCheckpoint(const EscritorCheckpoint&) = delete;
+    EscritorCheckpoint& operator=(const EscritorCheckpoint&) = delete;
+
+    bool libre();
+    EstadoGA& instantanea() { return llenando; }
+    void publicar();
+
+    /**
+     * @brief Espera a que termine la escritura en curso
+     * @return false si alguna escritura falló
+     */
+    bool esperar();
+
+private:
+    void bucle();
+
+    std::string ruta;
+    EstadoGA llenando;
+    EstadoGA escribiendo;
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool pendiente;
+    bool terminar;
+    bool hubo_error;
+    std::thread hilo;
+};
+
+#endif // CHECKPOINT_H
@@ -0,0 +1,112 @@
+#include "Componentes.h"
+#include <algorithm>
+#include <numeric>
+#include <utility>
+
+namespace {
+
+// Raíz con compresión por mitades
+int raiz(std::vector<int>& padre, int u) {
+    while (padre[u] != u) {
+        padre[u] = padre[padre[u]];
+        u = padre[u];
+    }
+    return u;
+}
+
+int ramificar(const std::vector<uint64_t>& cerrada, uint64_t vivos, uint64_t& mejor) {
+    if (!vivos) {
+        mejor = 0;
+        return 0;
+    }
+    int v = -1, grado_min = 65;
+    for (uint64_t r = vivos; r; r &= r - 1) {
+        int u = __builtin_ctzll(r);
+        int g = __builtin_popcountll(cerrada[u] & vivos);
+        if (g < grado_min) {
+            grado_min = g;
+            v = u;
+        }
+    }
+    int mejor_tam = -1;
+    for (uint64_t r = cerrada[v] & vivos; r; r &= r - 1) {
+        int u = __builtin_ctzll(r);
+        uint64_t sub;
+        int tam = 1 + ramificar(cerrada, vivos & ~cerrada[u], sub);
+        if (tam > mejor_tam) {
+            mejor_tam = tam;
+            mejor = sub | (1ULL << u);
+        }
+    }
+    return mejor_tam;
+}
+
+} // namespace
+
+std::vector<Componentes::Componente> Componentes::separar(const Grafo& grafo) {
+    int n = grafo.n;
+    std::vector<int> padre(n), tam(n, 1);
+    std::iota(padre.begin(), padre.end(), 0);
+    for (int u = 0; u < n; ++u) {
+        for (int v : grafo.vecinosDe(u)) {
+            if (v <= u) continue;
+            int a = raiz(padre, u), b = raiz(padre, v);
+            if (a == b) continue;
+            if (tam[a] < tam[b]) std::swap(a, b);
+            padre[b] = a;
+            tam[a] += tam[b];
+        }
+    }
+
+    // Índice de componente por raíz, en orden de menor nodo
+    std::vector<int> indice(n, -1);
+    std::vector<std::pair<int, int>> orden;  // (tamaño, raíz)
+    for (int u = 0; u < n; ++u) {
+        int r = raiz(padre, u);
+        if (indice[r] == -1) {
+            indice[r] = static_cast<int>(orden.size());
+            orden.emplace_back(tam[r], r);
+        }
+    }
+    if (orden.size() <= 1) return {};  // conexo: no se copia el grafo
+    std::stable_sort(orden.begin(), orden.end(),
+                     [](const std::pair<int, int>& a, const std::pair<int, int>& b) {
+                         return a.first > b.first;
+                     });
+
+    std::vector<Componente> componentes(orden.size());
+    for (size_t c = 0; c < orden.size(); ++c) {
+        indice[orden[c].second] = static_cast<int>(c);
+        componentes[c].nodos.reserve(orden[c].first);
+    }
+
+    // Nodos en orden ascendente: el id local conserva el orden original
+    std::vector<int> local(n);
+    for (int u = 0; u < n; ++u) {
+        std::vector<int>& nodos = componentes[indice[raiz(padre, u)]].nodos;
+        local[u] = static_cast<int>(nodos.size());
+        nodos.push_back(u);
+    }
+
+    std::vector<std::pair<int, int>> aristas;
+    for (Componente& comp : componentes) {
+        aristas.clear();
+        for (int u : comp.nodos) {
+            for (int v : grafo.vecinosDe(u)) {
+                if (v > u) aristas.emplace_back(local[u], local[v]);
+            }
+        }
+        comp.grafo.construirDesdeAristas(static_cast<int>(comp.nodos.size()), aristas);
+    }
+    return componentes;
+}
+
+int Componentes::resolverExacto(const Grafo& grafo, uint64_t& solucion) {
+    std::vector<uint64_t> cerrada(grafo.n);
+    for (int u = 0; u < grafo.n; ++u) {
+        cerrada[u] = 1ULL << u;
+        for (int v : grafo.vecinosDe(u)) cerrada[u] |= 1ULL << v;
+    }
+    uint64_t vivos = (grafo.n == 64) ? ~0ULL : (1ULL << grafo.n) - 1;
+    return ramificar(cerrada, vivos, solucion);
+}
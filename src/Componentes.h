@@ -0,0 +1,49 @@
+#ifndef COMPONENTES_H
+#define COMPONENTES_H
+
+#include <cstdint>
+#include <vector>
+#include "Grafo.h"
+
+/**
+ * @brief Descomposición del grafo en componentes conexas
+ *
+ * α(G) es la suma de α de cada componente, así que se pueden resolver por
+ * separado: las chicas (hasta TAM_EXACTO nodos) de forma exacta y las
+ * grandes cada una con su propio GA.
+ */
+class Componentes {
+public:
+    /**
+     * @brief Subgrafo inducido por una componente
+     */
+    struct Componente {
+        std::vector<int> nodos;  // id en el grafo original de cada nodo local (ascendente)
+        Grafo grafo;             // ids locales 0..nodos.size()-1
+    };
+
+    static constexpr int TAM_EXACTO = 40;  // hasta acá la ramificación es instantánea
+
+    /**
+     * @brief Separa el grafo en componentes con union-find sobre las aristas
+     *
+     * Las componentes quedan ordenadas de mayor a menor tamaño (a igual
+     * tamaño, por su menor nodo). Los vértices aislados son componentes de
+     * un nodo.
+     * @return Vacío si el grafo es conexo (no se copia el grafo entero)
+     */
+    static std::vector<Componente> separar(const Grafo& grafo);
+
+    /**
+     * @brief Conjunto independiente máximo por ramificación (n <= 64)
+     *
+     * Ramifica sobre el vértice v de menor grado: algún vértice de N[v]
+     * está en todo conjunto maximal.
+     * @param grafo Grafo de a lo sumo 64 nodos
+     * @param solucion Bits de la solución óptima (bit u = nodo u)
+     * @return α(grafo)
+     */
+    static int resolverExacto(const Grafo& grafo, uint64_t& solucion);
+};
+
+#endif // COMPONENTES_H
@@ -0,0 +1,18 @@
+#include "Cromosoma.h"
+#include <algorithm>
+
+Cromosoma::Cromosoma(int n)
+    : palabras((static_cast<size_t>(n) + BITS_POR_PALABRA - 1) / BITS_POR_PALABRA, 0),
+      n_bits(n) {}
+
+int Cromosoma::contar() const {
+    int total = 0;
+    for (uint64_t w : palabras) {
+        total += __builtin_popcountll(w);
+    }
+    return total;
+}
+
+void Cromosoma::limpiar() {
+    std::fill(palabras.begin(), palabras.end(), 0ULL);
+}
@@ -0,0 +1,93 @@
+#ifndef CROMOSOMA_H
+#define CROMOSOMA_H
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * @brief Cromosoma binario empaquetado en palabras de 64 bits
+ *
+ * El bit i vive en la palabra i / 64, posición i % 64. Los bits sobrantes de
+ * la última palabra se mantienen siempre en cero, de modo que los operadores
+ * pueden trabajar palabra a palabra (AND/OR/XOR, popcount) sin casos borde.
+ *
+ * La interfaz de acceso por índice imita a std::vector<bool> para que el
+ * código que asigna genes sueltos (greedy, inicialización) no cambie.
+ */
+class Cromosoma {
+public:
+    static const int BITS_POR_PALABRA = 64;
+
+    /**
+     * @brief Referencia a un gen individual (equivalente al proxy de vector<bool>)
+     */
+    class Referencia {
+    public:
+        Referencia(uint64_t* palabra, uint64_t mascara)
+            : palabra(palabra), mascara(mascara) {}
+
+        operator bool() const { return (*palabra & mascara) != 0; }
+
+        Referencia& operator=(bool valor) {
+            if (valor) *palabra |= mascara;
+            else       *palabra &= ~mascara;
+            return *this;
+        }
+
+        Referencia& operator=(const Referencia& otra) {
+            return *this = static_cast<bool>(otra);
+        }
+
+    private:
+        uint64_t* palabra;
+        uint64_t mascara;
+    };
+
+    Cromosoma() : n_bits(0) {}
+    explicit Cromosoma(int n);
+
+    size_t size() const { return n_bits; }
+    size_t numPalabras() const { return palabras.size(); }
+
+    bool operator[](size_t i) const {
+        return (palabras[i >> 6] >> (i & 63)) & 1ULL;
+    }
+
+    Referencia operator[](size_t i) {
+        return Referencia(&palabras[i >> 6], 1ULL << (i & 63));
+    }
+
+    void flip(size_t i) { palabras[i >> 6] ^= 1ULL << (i & 63); }
+
+    uint64_t* datos() { return palabras.data(); }
+    const uint64_t* datos() const { return palabras.data(); }
+
+    /**
+     * @brief Máscara de bits válidos de la última palabra
+     */
+    uint64_t mascaraUltima() const {
+        int resto = n_bits & 63;
+        return resto == 0 ? ~0ULL : ((1ULL << resto) - 1);
+    }
+
+    /**
+     * @brief Cuenta los genes activos (popcount palabra a palabra)
+     */
+    int contar() const;
+
+    /**
+     * @brief Pone todos los genes en cero
+     */
+    void limpiar();
+
+    bool operator==(const Cromosoma& otro) const {
+        return n_bits == otro.n_bits && palabras == otro.palabras;
+    }
+
+private:
+    std::vector<uint64_t> palabras;
+    size_t n_bits;
+};
+
+#endif // CROMOSOMA_H
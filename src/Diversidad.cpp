@@ -0,0 +1,122 @@
+#include "Diversidad.h"
+#include "Rng.h"
+#include <algorithm>
+#include <cstdio>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define DIVERSIDAD_X86 1
+#endif
+
+namespace {
+
+size_t hammingEscalar(const uint64_t* a, const uint64_t* b, size_t k) {
+    size_t d = 0;
+    for (size_t p = 0; p < k; ++p) d += __builtin_popcountll(a[p] ^ b[p]);
+    return d;
+}
+
+#ifdef DIVERSIDAD_X86
+// Sin -mpopcnt el compilador expande __builtin_popcountll en ~12 operaciones
+__attribute__((target("popcnt")))
+size_t hammingPopcnt(const uint64_t* a, const uint64_t* b, size_t k) {
+    size_t d = 0;
+    for (size_t p = 0; p < k; ++p) d += __builtin_popcountll(a[p] ^ b[p]);
+    return d;
+}
+#endif
+
+using FuncionHamming = size_t (*)(const uint64_t*, const uint64_t*, size_t);
+
+FuncionHamming elegirHamming() {
+#ifdef DIVERSIDAD_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("popcnt")) return hammingPopcnt;
+#endif
+    return hammingEscalar;
+}
+
+FuncionHamming hamming = elegirHamming();
+
+} // namespace
+
+void EstadisticasDiversidad::registrar(const MedidaDiversidad& medida) {
+    mediciones++;
+    suma_distancia += medida.distancia;
+    minima = std::min(minima, medida.distancia);
+    ultima = medida;
+    motores = 1;
+}
+
+void EstadisticasDiversidad::sumar(const EstadisticasDiversidad& otra) {
+    reinicios += otra.reinicios;
+    if (otra.mediciones == 0) return;
+    int total = motores + otra.motores;
+    ultima.distancia = (ultima.distancia * motores + otra.ultima.distancia * otra.motores) / total;
+    ultima.convergencia = (ultima.convergencia * motores + otra.ultima.convergencia * otra.motores) / total;
+    motores = total;
+    mediciones += otra.mediciones;
+    suma_distancia += otra.suma_distancia;
+    minima = std::min(minima, otra.minima);
+}
+
+MedidaDiversidad Diversidad::medir(const Poblacion& poblacion, long long generacion) {
+    MedidaDiversidad medida;
+    int pop_size = poblacion.tamano();
+    size_t num_palabras = poblacion.numPalabras();
+    if (pop_size < 2) return medida;
+
+    double suma = 0.0;
+    for (int k = 0; k < PARES_MUESTRA; ++k) {
+        uint64_t x = Rng::derivarSemilla(static_cast<uint64_t>(generacion), k);
+        int i = static_cast<int>(x % pop_size);
+        int j = static_cast<int>((i + 1 + (x >> 32) % (pop_size - 1)) % pop_size);
+        const uint64_t* a = poblacion.cromosoma(i);
+        const uint64_t* b = poblacion.cromosoma(j);
+        long long distinto = static_cast<long long>(hamming(a, b, num_palabras));
+
+        // Las filas son conjuntos independientes reparados: |a| es su fitness
+        long long unos = static_cast<long long>(poblacion.fitness(i)) + poblacion.fitness(j);
+        if (unos > 0) suma += static_cast<double>(distinto) / unos;
+    }
+    medida.distancia = suma / PARES_MUESTRA;
+
+    // Las filas vecinas comparten líneas de cache: recorrer por palabra
+    // mantiene en L1 el bloque de la población que se está leyendo
+    long long en_todos = 0, en_alguno = 0;
+    for (size_t p = 0; p < num_palabras; ++p) {
+        uint64_t y = ~0ULL, o = 0;
+        for (int i = 0; i < pop_size; ++i) {
+            uint64_t w = poblacion.cromosoma(i)[p];
+            y &= w;
+            o |= w;
+        }
+        en_todos += __builtin_popcountll(y);
+        en_alguno += __builtin_popcountll(o);
+    }
+    medida.convergencia = en_alguno ? static_cast<double>(en_todos) / en_alguno : 1.0;
+    return medida;
+}
+
+PoliticaReinicio::PoliticaReinicio(const ParametrosGA& params)
+    : umbral_diversidad(params.reinicio_diversidad),
+      segundos_estancamiento(params.reinicio_estancamiento),
+      ultima_mejora(0.0),
+      ultimo_reinicio(-GENERACIONES_MINIMAS) {}
+
+bool PoliticaReinicio::evaluar(const MedidaDiversidad& medida, long long generacion, double tiempo,
+                               std::string& motivo) {
+    if (generacion - ultimo_reinicio < GENERACIONES_MINIMAS) return false;
+
+    char buf[96];
+    if (umbral_diversidad > 0.0 && medida.distancia < umbral_diversidad) {
+        snprintf(buf, sizeof(buf), "diversidad %.4f", medida.distancia);
+    } else if (segundos_estancamiento > 0.0 && tiempo - ultima_mejora >= segundos_estancamiento) {
+        snprintf(buf, sizeof(buf), "sin mejora en %.1fs", tiempo - ultima_mejora);
+    } else {
+        return false;
+    }
+    motivo = buf;
+    ultimo_reinicio = generacion;
+    ultima_mejora = tiempo;
+    return true;
+}
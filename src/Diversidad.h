@@ -0,0 +1,86 @@
+#ifndef DIVERSIDAD_H
+#define DIVERSIDAD_H
+
+#include <string>
+#include "Parametros.h"
+#include "Poblacion.h"
+
+/**
+ * @brief Diversidad de una población en una generación
+ */
+struct MedidaDiversidad {
+    double distancia = 1.0;     // Hamming medio entre pares muestreados, sobre |a| + |b| (0 = clones)
+    double convergencia = 0.0;  // genes en 1 en todos / genes en 1 en alguno (1 = todos iguales)
+};
+
+/**
+ * @brief Resumen de las medidas de una corrida (por --stats json)
+ */
+struct EstadisticasDiversidad {
+    long long mediciones = 0;
+    double suma_distancia = 0.0;
+    double minima = 1.0;
+    MedidaDiversidad ultima;  // promedio sobre motores tras sumar()
+    int motores = 0;
+    int reinicios = 0;
+
+    void registrar(const MedidaDiversidad& medida);
+    void sumar(const EstadisticasDiversidad& otra);
+
+    double distanciaMedia() const { return mediciones ? suma_distancia / mediciones : 0.0; }
+};
+
+/**
+ * @brief Medidas de diversidad con popcount sobre la población empaquetada
+ */
+class Diversidad {
+public:
+    static constexpr int PARES_MUESTRA = 32;
+
+    /**
+     * @brief Mide la población en O(PARES_MUESTRA · palabras + pop · palabras)
+     *
+     * La distancia se promedia sobre PARES_MUESTRA pares distintos, elegidos
+     * a partir del número de generación (sin consumir los generadores del
+     * motor, así medir no cambia la corrida). La convergencia sale del AND
+     * y el OR de todas las filas: es la frecuencia alélica resumida en los
+     * genes que alguien tiene en 1.
+     */
+    static MedidaDiversidad medir(const Poblacion& poblacion, long long generacion);
+};
+
+/**
+ * @brief Cuándo reiniciar la población (--restart_diversity, --restart_stagnation)
+ *
+ * Pide un reinicio si la distancia cae debajo del umbral o si pasaron los
+ * segundos de estancamiento sin que mejore el mejor, y nunca antes de
+ * GENERACIONES_MINIMAS desde el reinicio anterior (una población recién
+ * sembrada con mucho greedy puede nacer poco diversa).
+ */
+class PoliticaReinicio {
+public:
+    static constexpr long long GENERACIONES_MINIMAS = 20;
+
+    explicit PoliticaReinicio(const ParametrosGA& params);
+
+    bool activa() const { return umbral_diversidad > 0.0 || segundos_estancamiento > 0.0; }
+
+    /**
+     * @brief Registra una mejora del mejor en 'tiempo'
+     */
+    void mejora(double tiempo) { ultima_mejora = tiempo; }
+
+    /**
+     * @return true si hay que reiniciar ahora; 'motivo' describe el disparador
+     */
+    bool evaluar(const MedidaDiversidad& medida, long long generacion, double tiempo,
+                 std::string& motivo);
+
+private:
+    double umbral_diversidad;
+    double segundos_estancamiento;
+    double ultima_mejora;
+    long long ultimo_reinicio;
+};
+
+#endif // DIVERSIDAD_H
@@ -0,0 +1,191 @@
+#include "Generadores.h"
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+namespace {
+
+// Uniforme en (0, 1]
+double uniformeAbierto(Rng& gen) {
+    return 1.0 - gen.uniforme();
+}
+
+// Junta las aristas para construir un Grafo
+class ListaAristas : public Generadores::Destino {
+public:
+    void arista(int64_t u, int64_t v) override {
+        aristas.emplace_back(static_cast<int>(u), static_cast<int>(v));
+    }
+
+    vector<pair<int, int>> aristas;
+};
+
+} // namespace
+
+void Generadores::erdos(int64_t n, double p, Rng& gen, Destino& out) {
+    if (p <= 0.0 || n < 2) return;
+    if (p >= 1.0) {
+        for (int64_t v = 1; v < n; ++v)
+            for (int64_t w = 0; w < v; ++w) out.arista(w, v);
+        return;
+    }
+    // Recorre los pares (w, v), w < v, saltando una cantidad geométrica
+    const double log_q = log1p(-p);
+    int64_t v = 1, w = -1;
+    while (v < n) {
+        w += 1 + static_cast<int64_t>(floor(log(uniformeAbierto(gen)) / log_q));
+        while (w >= v && v < n) {
+            w -= v;
+            ++v;
+        }
+        if (v < n) out.arista(w, v);
+    }
+}
+
+void Generadores::leyPotencia(int64_t n, double grado, double gamma, Rng& gen, Destino& out) {
+    if (n < 2) return;
+    // Pesos decrecientes con ley de potencias y grado medio esperado 'grado'
+    double exponente = 1.0 / (gamma - 1.0);
+    double i0 = 1.0;
+    vector<double> peso(n);
+    double suma = 0.0;
+    for (int64_t i = 0; i < n; ++i) {
+        peso[i] = pow(static_cast<double>(i) + i0, -exponente);
+        suma += peso[i];
+    }
+    double escala = grado * n / suma;
+    suma = 0.0;
+    for (double& x : peso) {
+        x *= escala;
+        suma += x;
+    }
+
+    // Fila u: candidatos v > u con probabilidad min(1, w_u w_v / S), que
+    // decrece con v; se salta geométricamente con la cota p y se acepta
+    // con q / p
+    for (int64_t u = 0; u + 1 < n; ++u) {
+        int64_t v = u + 1;
+        double p = min(1.0, peso[u] * peso[v] / suma);
+        while (v < n && p > 0.0) {
+            if (p < 1.0) {
+                v += static_cast<int64_t>(floor(log(uniformeAbierto(gen)) / log1p(-p)));
+            }
+            if (v >= n) break;
+            double q = min(1.0, peso[u] * peso[v] / suma);
+            if (gen.uniforme() < q / p) out.arista(u, v);
+            p = q;
+            ++v;
+        }
+    }
+}
+
+void Generadores::geometrico(int64_t n, double grado, Rng& gen, Destino& out) {
+    if (n < 2) return;
+    // pi r^2 n = grado
+    double r = sqrt(grado / (M_PI * n));
+    // Celdas de lado >= r, y no más celdas que puntos
+    int64_t celdas = max<int64_t>(1, static_cast<int64_t>(1.0 / r));
+    celdas = min<int64_t>(celdas, static_cast<int64_t>(ceil(sqrt(static_cast<double>(n)))));
+    double lado = 1.0 / celdas;
+
+    // Puntos ordenados por celda (conteo); el id de cada nodo es su
+    // posición en ese orden, así los vecinos quedan cerca en la numeración
+    vector<float> x0(n), y0(n);
+    vector<int64_t> inicio(celdas * celdas + 1, 0);
+    auto celda = [&](float x, float y) {
+        int64_t cx = min<int64_t>(celdas - 1, static_cast<int64_t>(x / lado));
+        int64_t cy = min<int64_t>(celdas - 1, static_cast<int64_t>(y / lado));
+        return cy * celdas + cx;
+    };
+    for (int64_t i = 0; i < n; ++i) {
+        x0[i] = static_cast<float>(gen.uniforme());
+        y0[i] = static_cast<float>(gen.uniforme());
+        inicio[celda(x0[i], y0[i]) + 1]++;
+    }
+    for (size_t c = 0; c + 1 < inicio.size(); ++c) inicio[c + 1] += inicio[c];
+    vector<float> xs(n), ys(n);
+    {
+        vector<int64_t> pos(inicio.begin(), inicio.end() - 1);
+        for (int64_t i = 0; i < n; ++i) {
+            int64_t k = pos[celda(x0[i], y0[i])]++;
+            xs[k] = x0[i];
+            ys[k] = y0[i];
+        }
+    }
+    vector<float>().swap(x0);
+    vector<float>().swap(y0);
+
+    double r2 = r * r;
+    // Cada par de celdas se revisa una vez: la propia y 4 vecinas "hacia adelante"
+    const int dx[] = {1, -1, 0, 1};
+    const int dy[] = {0, 1, 1, 1};
+    for (int64_t cy = 0; cy < celdas; ++cy) {
+        for (int64_t cx = 0; cx < celdas; ++cx) {
+            int64_t c = cy * celdas + cx;
+            for (int64_t i = inicio[c]; i < inicio[c + 1]; ++i) {
+                for (int64_t j = i + 1; j < inicio[c + 1]; ++j) {
+                    double ddx = xs[i] - xs[j], ddy = ys[i] - ys[j];
+                    if (ddx * ddx + ddy * ddy <= r2) out.arista(i, j);
+                }
+                for (int k = 0; k < 4; ++k) {
+                    int64_t nx = cx + dx[k], ny = cy + dy[k];
+                    if (nx < 0 || nx >= celdas || ny >= celdas) continue;
+                    int64_t d = ny * celdas + nx;
+                    for (int64_t j = inicio[d]; j < inicio[d + 1]; ++j) {
+                        double ddx = xs[i] - xs[j], ddy = ys[i] - ys[j];
+                        if (ddx * ddx + ddy * ddy <= r2) out.arista(min(i, j), max(i, j));
+                    }
+                }
+            }
+        }
+    }
+}
+
+void Generadores::grilla(int64_t n, Destino& out) {
+    int64_t filas = max<int64_t>(1, static_cast<int64_t>(sqrt(static_cast<double>(n))));
+    int64_t columnas = (n + filas - 1) / filas;
+    for (int64_t u = 0; u < n; ++u) {
+        int64_t c = u % columnas;
+        if (c + 1 < columnas && u + 1 < n) out.arista(u, u + 1);
+        if (u + columnas < n) out.arista(u, u + columnas);
+    }
+}
+
+bool Generadores::familiaValida(const string& familia) {
+    return familia == "erdos" || familia == "powerlaw" || familia == "geometric" || familia == "grid";
+}
+
+bool Generadores::generar(
+    const string& familia,
+    int64_t n,
+    double grado,
+    double p,
+    double gamma,
+    uint64_t semilla,
+    Destino& out
+) {
+    Rng gen(Rng::Tipo::XOSHIRO256, semilla);
+    if (familia == "erdos") {
+        erdos(n, (p >= 0.0) ? p : grado / max<int64_t>(1, n - 1), gen, out);
+    } else if (familia == "powerlaw") {
+        leyPotencia(n, grado, gamma, gen, out);
+    } else if (familia == "geometric") {
+        geometrico(n, grado, gen, out);
+    } else if (familia == "grid") {
+        grilla(n, out);
+    } else {
+        return false;
+    }
+    return true;
+}
+
+Grafo Generadores::construir(const string& familia, int n, double grado, double gamma, uint64_t semilla) {
+    ListaAristas lista;
+    generar(familia, n, grado, -1.0, gamma, semilla, lista);
+    Grafo grafo;
+    grafo.construirDesdeAristas(n, lista.aristas);
+    return grafo;
+}
@@ -0,0 +1,81 @@
+#ifndef GENERADORES_H
+#define GENERADORES_H
+
+#include <cstdint>
+#include <string>
+#include "Grafo.h"
+#include "Rng.h"
+
+/**
+ * @brief Familias de grafos sintéticos (las de tools/generar_grafo)
+ *
+ * Cada generador entrega las aristas a un Destino a medida que las
+ * produce: tools/generar_grafo las escribe a disco sin guardarlas y
+ * construir() arma el Grafo en memoria, así un benchmark mide exactamente
+ * el grafo que da la herramienta con la misma familia, n, grado y semilla.
+ * La memoria propia es O(1) para erdos y grid, y O(n) para powerlaw y
+ * geometric (pesos y coordenadas).
+ */
+class Generadores {
+public:
+    /**
+     * @brief Receptor de aristas (u, v) de un generador
+     */
+    class Destino {
+    public:
+        virtual ~Destino() = default;
+        virtual void arista(int64_t u, int64_t v) = 0;
+    };
+
+    /**
+     * @brief G(n, p) con saltos geométricos (Batagelj-Brandes), O(n + m)
+     */
+    static void erdos(int64_t n, double p, Rng& gen, Destino& out);
+
+    /**
+     * @brief Chung-Lu con pesos w_i ~ (i + 1)^(-1/(gamma-1)) escalados a
+     *        grado medio 'grado', con saltos geométricos por fila
+     *        (Miller-Hagberg), O(n + m); los hubs quedan en los ids bajos
+     */
+    static void leyPotencia(int64_t n, double grado, double gamma, Rng& gen, Destino& out);
+
+    /**
+     * @brief n puntos en el cuadrado unitario, arista si distancia <= r con
+     *        pi r^2 n = grado; ids ordenados por celda de lado r
+     */
+    static void geometrico(int64_t n, double grado, Rng& gen, Destino& out);
+
+    /**
+     * @brief Grilla de floor(sqrt(n)) filas, vecinos a derecha y abajo
+     */
+    static void grilla(int64_t n, Destino& out);
+
+    /**
+     * @brief ¿'familia' es erdos, powerlaw, geometric o grid?
+     */
+    static bool familiaValida(const std::string& familia);
+
+    /**
+     * @brief Genera una familia con un Rng XOSHIRO256 de 'semilla'
+     * @param p Probabilidad de arista para erdos; si es negativa se usa
+     *          grado / (n - 1)
+     * @return false si la familia no existe
+     */
+    static bool generar(
+        const std::string& familia,
+        int64_t n,
+        double grado,
+        double p,
+        double gamma,
+        uint64_t semilla,
+        Destino& out
+    );
+
+    /**
+     * @brief Grafo en memoria igual al que escribe tools/generar_grafo
+     *        con --grado 'grado' --gamma 'gamma' --seed 'semilla'
+     */
+    static Grafo construir(const std::string& familia, int n, double grado, double gamma, uint64_t semilla);
+};
+
+#endif // GENERADORES_H
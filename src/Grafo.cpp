@@ -1,33 +1,348 @@
 #include "Grafo.h"
-#include <fstream>
+#include <algorithm>
+#include <climits>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
 #include <iostream>
+#include <random>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+// Formato binario del cache (.csr), little-endian:
+//   EncabezadoCache | offsets[n+1] (int64) | vecinos[2m] (int32)
+const char MAGIA_CACHE[8] = {'M', 'I', 'S', 'P', 'C', 'S', 'R', '1'};
+const uint32_t VERSION_CACHE = 1;
+
+struct EncabezadoCache {
+    char magia[8];
+    uint32_t version;
+    uint32_t bytes_indice;      // sizeof(int64_t), detecta layouts distintos
+    uint64_t tam_fuente;        // tamaño del .graph al generar el cache
+    int64_t mtime_fuente;       // fecha de modificación del .graph
+    int64_t n;
+    int64_t num_vecinos;
+};
+
+// Contenido completo de un archivo en memoria: mmap en POSIX (sin copia),
+// lectura a un buffer en Windows.
+class ArchivoMapeado {
+public:
+    explicit ArchivoMapeado(const std::string& ruta) {
+#ifndef _WIN32
+        int fd = open(ruta.c_str(), O_RDONLY);
+        if (fd < 0) return;
+        struct stat st;
+        if (fstat(fd, &st) == 0) {
+            tam = static_cast<size_t>(st.st_size);
+            valido = true;
+            if (tam > 0) {
+                void* p = mmap(nullptr, tam, PROT_READ, MAP_PRIVATE, fd, 0);
+                if (p == MAP_FAILED) {
+                    valido = false;
+                } else {
+                    madvise(p, tam, MADV_SEQUENTIAL);
+                    datos = static_cast<const char*>(p);
+                    mapeado = true;
+                }
+            }
+        }
+        close(fd);
+#else
+        FILE* f = std::fopen(ruta.c_str(), "rb");
+        if (!f) return;
+        std::fseek(f, 0, SEEK_END);
+        tam = static_cast<size_t>(std::ftell(f));
+        std::fseek(f, 0, SEEK_SET);
+        buffer.resize(tam);
+        valido = std::fread(buffer.data(), 1, tam, f) == tam;
+        datos = buffer.data();
+        std::fclose(f);
+#endif
+    }
+
+    ~ArchivoMapeado() {
+#ifndef _WIN32
+        if (mapeado) munmap(const_cast<char*>(datos), tam);
+#endif
+    }
+
+    ArchivoMapeado(const ArchivoMapeado&) = delete;
+    ArchivoMapeado& operator=(const ArchivoMapeado&) = delete;
+
+    bool valido = false;
+    const char* datos = nullptr;
+    size_t tam = 0;
+
+private:
+    bool mapeado = false;
+    std::vector<char> buffer;
+};
+
+// Lector de enteros sobre el texto mapeado (equivalente a 'in >> x')
+struct Escaner {
+    const char* p;
+    const char* fin;
+
+    bool leer(int& x) {
+        while (p < fin && static_cast<unsigned char>(*p) <= ' ') ++p;
+        if (p == fin) return false;
+        bool negativo = (*p == '-');
+        if (negativo) ++p;
+        unsigned digito;
+        if (p == fin || (digito = static_cast<unsigned char>(*p) - '0') > 9) return false;
+        uint64_t valor = 0;
+        int cifras = 0;
+        do {
+            valor = valor * 10 + digito;
+            ++cifras;
+            ++p;
+        } while (p < fin && (digito = static_cast<unsigned char>(*p) - '0') <= 9);
+        if (cifras > 10 || valor > INT32_MAX) valor = INT32_MAX;  // fuera de rango: se descarta luego
+        x = negativo ? -static_cast<int>(valor) : static_cast<int>(valor);
+        return true;
+    }
+};
+
+// Arma el CSR con dos recorridos de las aristas (conteo y llenado), luego
+// ordena cada fila y compacta los duplicados. 'recorrer(f)' llama f(u, v)
+// por cada arista de la entrada.
+template <typename Recorrido>
+void construirCSR(Grafo& g, int num_nodos, Recorrido recorrer) {
+    g.n = num_nodos;
+    g.offsets.assign(g.n + 1, 0);
+
+    auto valida = [&](int u, int v) {
+        return u >= 0 && u < g.n && v >= 0 && v < g.n && u != v;
+    };
+
+    recorrer([&](int u, int v) {
+        if (!valida(u, v)) return;
+        g.offsets[u + 1]++;
+        g.offsets[v + 1]++;
+    });
+    for (int i = 0; i < g.n; ++i) g.offsets[i + 1] += g.offsets[i];
+
+    g.vecinos.assign(g.offsets[g.n], 0);
+    std::vector<int64_t> pos(g.offsets.begin(), g.offsets.end() - 1);
+    recorrer([&](int u, int v) {
+        if (!valida(u, v)) return;
+        g.vecinos[pos[u]++] = v;
+        g.vecinos[pos[v]++] = u;
+    });
+
+    // Deduplicación por ordenamiento de cada fila
+    int64_t escritura = 0;
+    for (int i = 0; i < g.n; ++i) {
+        auto ini = g.vecinos.begin() + g.offsets[i];
+        auto fin = g.vecinos.begin() + g.offsets[i + 1];
+        std::sort(ini, fin);
+        auto fin_unico = std::unique(ini, fin);
+        g.offsets[i] = escritura;
+        escritura = std::copy(ini, fin_unico, g.vecinos.begin() + escritura) - g.vecinos.begin();
+    }
+    g.offsets[g.n] = escritura;
+    g.vecinos.resize(escritura);
+    g.vecinos.shrink_to_fit();
+
+    if (Grafo::convieneMatrizBits(g.n, g.numAristas())) g.construirMatrizBits();
+    else g.liberarMatrizBits();
+}
+
+// Marca de versión del archivo fuente: tamaño y fecha de modificación
+bool marcaFuente(const std::string& ruta, uint64_t& tam, int64_t& mtime) {
+    std::error_code ec;
+    tam = std::filesystem::file_size(ruta, ec);
+    if (ec) return false;
+    auto t = std::filesystem::last_write_time(ruta, ec);
+    if (ec) return false;
+    mtime = static_cast<int64_t>(t.time_since_epoch().count());
+    return true;
+}
+
+} // namespace
 
 bool Grafo::cargarDesdeArchivo(const std::string& filename) {
-    std::ifstream in(filename);
-    if (!in) {
+    ArchivoMapeado archivo(filename);
+    if (!archivo.valido) {
         std::cerr << "Error: No se pudo abrir el archivo: " << filename << std::endl;
         return false;
     }
-    
-    n = 0;
-    in >> n;
-    
-    adj.resize(n);
-    std::vector<std::unordered_set<int>> adj_set(n);
-    
-    int u, v;
-    while (in >> u >> v) {
-        if (u < 0 || u >= n || v < 0 || v >= n || u == v) continue;
-        
-        // Usamos adj_set.insert().second para no duplicar aristas en 'adj'
-        if (adj_set[u].insert(v).second) { 
-            adj[u].push_back(v);
-        }
-        if (adj_set[v].insert(u).second) {
-            adj[v].push_back(u);
-        }
+
+    Escaner inicio{archivo.datos, archivo.datos + archivo.tam};
+    int num_nodos = 0;
+    if (!inicio.leer(num_nodos) || num_nodos < 0) num_nodos = 0;
+
+    construirCSR(*this, num_nodos, [&](auto&& f) {
+        Escaner esc = inicio;
+        int u, v;
+        while (esc.leer(u) && esc.leer(v)) f(u, v);
+    });
+    return true;
+}
+
+bool Grafo::cargarConCache(const std::string& filename) {
+    std::string ruta_cache = rutaCache(filename);
+    uint64_t tam = 0;
+    int64_t mtime = 0;
+    bool hay_marca = marcaFuente(filename, tam, mtime);
+
+    if (hay_marca && cargarBinario(ruta_cache, tam, mtime)) {
+        return true;
+    }
+    if (!cargarDesdeArchivo(filename)) {
+        return false;
+    }
+    if (hay_marca) {
+        guardarBinario(ruta_cache, tam, mtime);  // sin permisos de escritura: se ignora
     }
-    in.close();
-    
     return true;
 }
+
+std::string Grafo::rutaCache(const std::string& filename) {
+    return filename + ".csr";
+}
+
+bool Grafo::guardarBinario(const std::string& ruta, uint64_t tam_fuente, int64_t mtime_fuente) const {
+    EncabezadoCache enc;
+    std::memcpy(enc.magia, MAGIA_CACHE, sizeof(enc.magia));
+    enc.version = VERSION_CACHE;
+    enc.bytes_indice = sizeof(int64_t);
+    enc.tam_fuente = tam_fuente;
+    enc.mtime_fuente = mtime_fuente;
+    enc.n = n;
+    enc.num_vecinos = static_cast<int64_t>(vecinos.size());
+
+    // Escritura a un temporal y rename: otra corrida concurrente nunca ve
+    // un cache a medio escribir
+    std::string temporal = ruta + ".tmp" + std::to_string(std::random_device{}());
+    FILE* f = std::fopen(temporal.c_str(), "wb");
+    if (!f) return false;
+    bool ok = std::fwrite(&enc, sizeof(enc), 1, f) == 1
+           && std::fwrite(offsets.data(), sizeof(int64_t), offsets.size(), f) == offsets.size()
+           && std::fwrite(vecinos.data(), sizeof(int), vecinos.size(), f) == vecinos.size();
+    ok = (std::fclose(f) == 0) && ok;
+
+    std::error_code ec;
+    if (ok) std::filesystem::rename(temporal, ruta, ec);
+    if (!ok || ec) {
+        std::filesystem::remove(temporal, ec);
+        return false;
+    }
+    return true;
+}
+
+bool Grafo::cargarBinario(const std::string& ruta, uint64_t tam_fuente, int64_t mtime_fuente) {
+    FILE* f = std::fopen(ruta.c_str(), "rb");
+    if (!f) return false;
+
+    EncabezadoCache enc;
+    bool ok = std::fread(&enc, sizeof(enc), 1, f) == 1
+           && std::memcmp(enc.magia, MAGIA_CACHE, sizeof(enc.magia)) == 0
+           && enc.version == VERSION_CACHE
+           && enc.bytes_indice == sizeof(int64_t)
+           && enc.tam_fuente == tam_fuente
+           && enc.mtime_fuente == mtime_fuente
+           && enc.n >= 0 && enc.n < INT32_MAX && enc.num_vecinos >= 0;
+
+    // El tamaño debe cuadrar antes de reservar lo que pide el encabezado
+    std::error_code ec;
+    uint64_t tam_cache = std::filesystem::file_size(ruta, ec);
+    ok = ok && !ec
+       && tam_cache == sizeof(enc) + static_cast<uint64_t>(enc.n + 1) * sizeof(int64_t)
+                       + static_cast<uint64_t>(enc.num_vecinos) * sizeof(int);
+
+    if (ok) {
+        offsets.resize(enc.n + 1);
+        vecinos.resize(enc.num_vecinos);
+        ok = std::fread(offsets.data(), sizeof(int64_t), offsets.size(), f) == offsets.size()
+          && std::fread(vecinos.data(), sizeof(int), vecinos.size(), f) == vecinos.size()
+          && offsets[0] == 0 && offsets[enc.n] == enc.num_vecinos;
+        n = static_cast<int>(enc.n);
+    }
+    std::fclose(f);
+
+    // Un cache corrupto no debe dejar índices fuera de rango: offsets no
+    // decrecientes y listas ordenadas (sonAdyacentes busca binario) de ids
+    // en [0, n)
+    for (int u = 0; ok && u < n; ++u) ok = offsets[u] <= offsets[u + 1];
+    for (int u = 0; ok && u < n; ++u) {
+        for (int64_t k = offsets[u]; ok && k < offsets[u + 1]; ++k) {
+            ok = vecinos[k] >= 0 && vecinos[k] < n
+              && (k == offsets[u] || vecinos[k - 1] < vecinos[k]);
+        }
+    }
+
+    if (!ok) {
+        n = 0;
+        offsets.clear();
+        vecinos.clear();
+    }
+    if (ok && convieneMatrizBits(n, numAristas())) construirMatrizBits();
+    else liberarMatrizBits();
+    return ok;
+}
+
+void Grafo::construirDesdeAristas(int num_nodos, std::vector<std::pair<int, int>>& aristas) {
+    construirCSR(*this, num_nodos, [&](auto&& f) {
+        for (const auto& [u, v] : aristas) f(u, v);
+    });
+    std::vector<std::pair<int, int>>().swap(aristas);
+}
+
+bool Grafo::sonAdyacentes(int a, int b) const {
+    if (grado(a) > grado(b)) std::swap(a, b);
+    Vecinos lista = vecinosDe(a);
+    return std::binary_search(lista.begin(), lista.end(), b);
+}
+
+bool Grafo::convieneMatrizBits(int num_nodos, int64_t num_aristas) {
+    if (num_nodos < 2) return false;
+    double densidad = 2.0 * num_aristas / (static_cast<double>(num_nodos) * (num_nodos - 1));
+    size_t palabras = (static_cast<size_t>(num_nodos) + 63) / 64;
+    return densidad >= DENSIDAD_MIN_MATRIZ
+        && palabras * num_nodos * sizeof(uint64_t) <= MAX_BYTES_MATRIZ;
+}
+
+void Grafo::construirMatrizBits() {
+    palabras_fila = (static_cast<size_t>(n) + 63) / 64;
+    matriz_bits.assign(palabras_fila * n, 0);
+    for (int u = 0; u < n; ++u) {
+        uint64_t* fila = matriz_bits.data() + static_cast<size_t>(u) * palabras_fila;
+        for (int v : vecinosDe(u)) fila[v >> 6] |= 1ULL << (v & 63);
+    }
+}
+
+void Grafo::liberarMatrizBits() {
+    std::vector<uint64_t>().swap(matriz_bits);
+    palabras_fila = 0;
+}
+
+size_t Grafo::memoriaCSR() const {
+    return sizeof(Grafo)
+         + offsets.capacity() * sizeof(int64_t)
+         + vecinos.capacity() * sizeof(int);
+}
+
+size_t Grafo::memoriaListasEstimada() const {
+    const size_t overhead_malloc = 8;   // encabezado de bloque (glibc, 64 bits)
+    const size_t alineacion = 16;
+
+    size_t total = sizeof(int) + n * sizeof(std::vector<int>);
+    for (int u = 0; u < n; ++u) {
+        size_t g = grado(u);
+        if (g == 0) continue;
+        size_t capacidad = 1;
+        while (capacidad < g) capacidad <<= 1;
+        size_t bloque = capacidad * sizeof(int) + overhead_malloc;
+        total += (bloque + alineacion - 1) / alineacion * alineacion;
+    }
+    return total;
+}
@@ -2,23 +2,149 @@
 #define GRAFO_H
 
 #include <vector>
-#include <unordered_set>
 #include <string>
+#include <utility>
+#include <cstdint>
+#include <cstddef>
 
 /**
  * @brief Clase para manejar la carga y representación del grafo
+ *
+ * La adyacencia se guarda en formato CSR (compressed sparse row): los
+ * vecinos de u ocupan vecinos[offsets[u] .. offsets[u+1]) en un único
+ * arreglo contiguo, ordenados ascendentemente y sin duplicados.
  */
 class Grafo {
 public:
-    int n; // Número de nodos
-    std::vector<std::vector<int>> adj;           // Lista de adyacencia
-    
     /**
-     * @brief Carga un grafo desde un archivo
+     * @brief Rango de vecinos de un nodo (vista sobre el arreglo CSR)
+     */
+    struct Vecinos {
+        const int* ini;
+        const int* fin;
+
+        const int* begin() const { return ini; }
+        const int* end() const { return fin; }
+        size_t size() const { return fin - ini; }
+    };
+
+    int n = 0;                      // Número de nodos
+    std::vector<int64_t> offsets;   // n + 1 posiciones de inicio
+    std::vector<int> vecinos;       // 2m vecinos concatenados
+
+    // Matriz de adyacencia en bits, solo en grafos densos (ver
+    // convieneMatrizBits): la fila u ocupa palabras_fila palabras
+    std::vector<uint64_t> matriz_bits;
+    size_t palabras_fila = 0;
+
+    Vecinos vecinosDe(int u) const {
+        return {vecinos.data() + offsets[u], vecinos.data() + offsets[u + 1]};
+    }
+
+    int grado(int u) const {
+        return static_cast<int>(offsets[u + 1] - offsets[u]);
+    }
+
+    int64_t numAristas() const { return static_cast<int64_t>(vecinos.size()) / 2; }
+
+    /**
+     * @brief Consulta de adyacencia por búsqueda binaria en la lista más corta
+     */
+    bool sonAdyacentes(int a, int b) const;
+
+    /**
+     * @brief Carga un grafo desde un archivo de texto
+     *
+     * El archivo se mapea en memoria y se recorre dos veces (conteo de
+     * grados y llenado del CSR), sin lista intermedia de aristas.
      * @param filename Ruta al archivo del grafo
      * @return true si la carga fue exitosa, false en caso contrario
      */
     bool cargarDesdeArchivo(const std::string& filename);
+
+    /**
+     * @brief Carga el grafo usando el cache binario junto al .graph
+     *
+     * Si existe '<archivo>.csr' y corresponde a la versión actual del
+     * archivo (mismo tamaño y fecha de modificación) se lee directamente;
+     * si no, se parsea el texto y se (re)escribe el cache.
+     * @param filename Ruta al archivo del grafo
+     * @return true si la carga fue exitosa, false en caso contrario
+     */
+    bool cargarConCache(const std::string& filename);
+
+    /**
+     * @brief Ruta del cache binario asociado a un archivo de grafo
+     */
+    static std::string rutaCache(const std::string& filename);
+
+    /**
+     * @brief Serializa el CSR a un archivo binario
+     * @param ruta Archivo de destino (se escribe a un temporal y se renombra)
+     * @param tam_fuente Tamaño del .graph de origen
+     * @param mtime_fuente Fecha de modificación del .graph de origen
+     */
+    bool guardarBinario(const std::string& ruta, uint64_t tam_fuente, int64_t mtime_fuente) const;
+
+    /**
+     * @brief Lee un CSR binario; falla si no coincide con la fuente indicada
+     *
+     * También falla si el cuerpo es inconsistente (tamaño, offsets que
+     * decrecen, vecinos fuera de [0, n) o desordenados); el llamador vuelve
+     * entonces a parsear el .graph.
+     */
+    bool cargarBinario(const std::string& ruta, uint64_t tam_fuente, int64_t mtime_fuente);
+
+    /**
+     * @brief Construye el CSR a partir de una lista de aristas no dirigidas
+     *
+     * Descarta lazos y aristas fuera de rango, y elimina duplicados.
+     * @param num_nodos Número de nodos
+     * @param aristas Pares (u, v); se consume (queda vacía)
+     */
+    void construirDesdeAristas(int num_nodos, std::vector<std::pair<int, int>>& aristas);
+
+    /**
+     * @brief Indica si conviene guardar la matriz de adyacencia en bits
+     *
+     * Revisar una fila de n/64 palabras con AND cuesta lo mismo que
+     * recorrer ~densidad·n vecinos uno a uno cerca de densidad 0.01
+     * (medido con bench/bench_simd); desde DENSIDAD_MIN_MATRIZ se usa la
+     * matriz, salvo que supere MAX_BYTES_MATRIZ.
+     */
+    static bool convieneMatrizBits(int num_nodos, int64_t num_aristas);
+
+    static constexpr double DENSIDAD_MIN_MATRIZ = 0.01;
+    static constexpr size_t MAX_BYTES_MATRIZ = size_t(128) << 20;
+
+    /**
+     * @brief Construye matriz_bits a partir del CSR
+     */
+    void construirMatrizBits();
+
+    /**
+     * @brief Libera matriz_bits (la reparación vuelve al recorrido CSR)
+     */
+    void liberarMatrizBits();
+
+    bool tieneMatrizBits() const { return !matriz_bits.empty(); }
+
+    const uint64_t* filaBits(int u) const {
+        return matriz_bits.data() + static_cast<size_t>(u) * palabras_fila;
+    }
+
+    /**
+     * @brief Bytes ocupados por el layout CSR
+     */
+    size_t memoriaCSR() const;
+
+    /**
+     * @brief Bytes estimados del layout vector<vector<int>> equivalente
+     *
+     * Considera el encabezado de cada vector, la capacidad que deja
+     * push_back (potencia de dos) y el overhead por bloque de malloc.
+     */
+    size_t memoriaListasEstimada() const;
 };
 
 #endif // GRAFO_H
@@ -1,107 +1,199 @@
 #include "Greedy.h"
 #include <algorithm>
+#include <functional>
+#include <tuple>
+
+namespace {
+
+// Recorre las colas en orden de grado ascendente materializando solo el
+// prefijo que se necesita.
+struct RecorridoPorGrado {
+    const Greedy::ColasPorGrado& colas;
+    std::vector<int>& orden;
+    int d;
+    int v;
+
+    RecorridoPorGrado(const Greedy::ColasPorGrado& colas, std::vector<int>& orden)
+        : colas(colas), orden(orden), d(colas.dmin), v(-1) {
+        orden.clear();
+    }
+
+    // Asegura que orden[i] exista; false si hay menos de i+1 nodos vivos
+    bool extender(size_t i) {
+        int max_grado = static_cast<int>(colas.cabeza.size()) - 1;
+        while (orden.size() <= i) {
+            if (d > max_grado) return false;
+            v = (v == -1) ? colas.cabeza[d] : colas.sig[v];
+            while (v == -1) {
+                if (++d > max_grado) return false;
+                v = colas.cabeza[d];
+            }
+            orden.push_back(v);
+        }
+        return true;
+    }
+};
+
+} // namespace
+
+Greedy::Base::Base(const Grafo& grafo) : grafo(grafo), grado(grafo.n) {
+    int n = grafo.n;
+    int max_grado = 0;
+    for (int i = 0; i < n; ++i) {
+        grado[i] = grafo.grado(i);
+        max_grado = std::max(max_grado, grado[i]);
+    }
+    colas.cabeza.assign(max_grado + 1, -1);
+    colas.sig.assign(n, -1);
+    colas.ant.assign(n, -1);
+    colas.dmin = max_grado;
+    for (int i = n - 1; i >= 0; --i) colas.insertar(i, grado[i]);
+}
 
 std::vector<int> Greedy::generarSolucion(
-    const std::vector<std::vector<int>>& adj,
+    const Grafo& grafo,
     int k,
-    std::mt19937& gen
+    Rng& gen
 ) {
-    int n = adj.size();
-    if (n == 0) return {};
-    
-    // --- NUEVO: Crear una matriz de adyacencia local ---
-    // Esto nos da búsquedas O(1) sin necesitar el adj_set permanente
-    std::vector<std::vector<char>> adj_matrix(n, std::vector<char>(n, 0));
-    for (int u = 0; u < n; ++u) {
-        for (int v : adj[u]) {
-            adj_matrix[u][v] = 1;
-        }
-    }
-    // --- FIN NUEVO ---
+    Base base(grafo);
+    Espacio espacio;
+    return generar(base, espacio, k, gen);
+}
+
+const std::vector<int>& Greedy::generar(const Base& base, Espacio& espacio, int k, Rng& gen) {
+    const Grafo& grafo = base.grafo;
+    int n = grafo.n;
+    std::vector<int>& independent_set = espacio.solucion;
+    independent_set.clear();
+    if (n == 0 || k <= 0) return independent_set;
 
-    std::vector<int> curr_deg(n);
-    for (int i = 0; i < n; ++i) curr_deg[i] = adj[i].size();
-    
-    std::vector<char> removed(n, 0);
+    // Estado inicial copiado de la base (las asignaciones reutilizan la
+    // capacidad de la corrida anterior)
+    std::vector<int>& curr_deg = espacio.grado;
+    ColasPorGrado& colas = espacio.colas;
+    curr_deg = base.grado;
+    colas = base.colas;
+    std::vector<char>& removed = espacio.quitado;
+    removed.assign(n, 0);
     int remaining = n;
-    std::vector<int> independent_set;
-    
+
+    // Estructuras reutilizadas entre pasos
+    std::vector<int>& orden = espacio.orden;
+    std::vector<std::pair<int, int>>& rcl = espacio.rcl;
+    std::vector<int>& Slist = espacio.quitados;
+
+    // Heap de pares (suma de grados, i, j) sobre posiciones de 'orden', i < j
+    using EntradaPar = std::tuple<int, int, int>;
+    std::vector<EntradaPar>& pares = espacio.pares;
+    auto empujarPar = [&](int i, int j) {
+        pares.emplace_back(curr_deg[orden[i]] + curr_deg[orden[j]], i, j);
+        std::push_heap(pares.begin(), pares.end(), std::greater<EntradaPar>());
+    };
+
     while (remaining > 0) {
-        std::vector<std::pair<double, std::vector<int>>> candidates;
-        
-        for (int a = 0; a < n; ++a) {
-            if (removed[a]) continue;
-            candidates.push_back({(double)curr_deg[a], {a}});
-            
-            for (int b = a + 1; b < n; ++b) {
-                // --- CAMBIO CLAVE ---
-                // Usamos la matriz O(1) en lugar del set
-                if (removed[b] || adj_matrix[a][b]) continue;
-                // --- FIN CAMBIO ---
-                candidates.push_back({(double)(curr_deg[a] + curr_deg[b]) / 2.0, {a, b}});
+        // Avanzar dmin hasta la primera cola no vacía
+        while (colas.cabeza[colas.dmin] == -1) ++colas.dmin;
+
+        // Lista restringida de candidatos: los k menores entre nodos simples
+        // (clave = grado) y pares no adyacentes (clave = promedio de grados).
+        // Se mezclan dos flujos ordenados: los nodos en orden de grado y un
+        // heap de pares, así nunca se enumeran todos los pares.
+        RecorridoPorGrado recorrido(colas, orden);
+        pares.clear();
+        rcl.clear();
+
+        size_t siguiente_simple = 0;
+        bool hay_simples = recorrido.extender(0);
+        if (recorrido.extender(1)) empujarPar(0, 1);
+
+        while (static_cast<int>(rcl.size()) < k && (hay_simples || !pares.empty())) {
+            // A igual clave, el candidato simple va primero
+            bool tomar_simple = hay_simples &&
+                (pares.empty() ||
+                 2 * curr_deg[orden[siguiente_simple]] <= std::get<0>(pares.front()));
+
+            if (tomar_simple) {
+                rcl.push_back({orden[siguiente_simple], -1});
+                hay_simples = recorrido.extender(++siguiente_simple);
+                continue;
+            }
+
+            std::pop_heap(pares.begin(), pares.end(), std::greater<EntradaPar>());
+            int i = std::get<1>(pares.back());
+            int j = std::get<2>(pares.back());
+            pares.pop_back();
+
+            // Sucesores en el orden de sumas: (i, j+1) y, al abrir una fila, (i+1, i+2)
+            if (recorrido.extender(j + 1)) empujarPar(i, j + 1);
+            if (j == i + 1 && recorrido.extender(i + 2)) empujarPar(i + 1, i + 2);
+
+            int a = orden[i];
+            int b = orden[j];
+            if (!grafo.sonAdyacentes(a, b)) {
+                rcl.push_back({std::min(a, b), std::max(a, b)});
             }
         }
-        
-        if (candidates.empty()) break;
-        
-        std::sort(candidates.begin(), candidates.end());
-        int limit = std::min(k, (int)candidates.size());
-        if (limit == 0) break;
-        
-        std::uniform_int_distribution<> dis(0, limit - 1);
-        std::vector<int> bestH = candidates[dis(gen)].second;
-        
-        independent_set.insert(independent_set.end(), bestH.begin(), bestH.end());
-        
-        std::vector<int> Slist;
-        std::vector<char> inS(n, 0);
-        
-        for (int x : bestH) {
-            if (!inS[x]) {
-                inS[x] = 1;
+
+        if (rcl.empty()) break;
+
+        std::pair<int, int> elegido = rcl[gen.acotado(static_cast<uint32_t>(rcl.size()))];
+
+        int bestH[2] = {elegido.first, elegido.second};
+        int tam_bestH = (elegido.second == -1) ? 1 : 2;
+        independent_set.insert(independent_set.end(), bestH, bestH + tam_bestH);
+
+        // Eliminar los nodos elegidos y sus vecinos vivos
+        Slist.clear();
+        for (int t = 0; t < tam_bestH; ++t) {
+            int x = bestH[t];
+            if (!removed[x]) {
+                removed[x] = 1;
                 Slist.push_back(x);
             }
         }
-        
-        for (int x : bestH) {
-            for (int nb : adj[x]) {
-                if (!inS[nb] && !removed[nb]) {
-                    inS[nb] = 1;
+        for (int t = 0; t < tam_bestH; ++t) {
+            for (int nb : grafo.vecinosDe(bestH[t])) {
+                if (!removed[nb]) {
+                    removed[nb] = 1;
                     Slist.push_back(nb);
                 }
             }
         }
-        
+
         for (int s : Slist) {
-            if (removed[s]) continue;
-            removed[s] = 1;
+            colas.quitar(s, curr_deg[s]);
             remaining--;
-            for (int nb : adj[s]) {
-                if (!removed[nb]) curr_deg[nb]--;
+        }
+        for (int s : Slist) {
+            for (int nb : grafo.vecinosDe(s)) {
+                if (!removed[nb]) {
+                    colas.quitar(nb, curr_deg[nb]);
+                    curr_deg[nb]--;
+                    colas.insertar(nb, curr_deg[nb]);
+                }
             }
             curr_deg[s] = 0;
         }
     }
-    
+
     return independent_set;
 }
 
 Individuo Greedy::crearIndividuo(
-    const std::vector<std::vector<int>>& adj,
+    const Grafo& grafo,
     int k,
-    std::mt19937& gen
+    Rng& gen
 ) {
-    int n = adj.size();
-    
-    // La llamada ahora solo pasa 'adj'
-    std::vector<int> independent_set = generarSolucion(adj, k, gen);
-    
+    int n = grafo.n;
+
+    std::vector<int> independent_set = generarSolucion(grafo, k, gen);
+
     Individuo ind(n);
     for (int nodo : independent_set) {
         ind.cromosoma[nodo] = true;
     }
-    
+
     ind.fitness = independent_set.size();
-    
+
     return ind;
-}
\ No newline at end of file
+}
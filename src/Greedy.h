@@ -1,42 +1,111 @@
 #ifndef GREEDY_H
 #define GREEDY_H
 
+#include <tuple>
+#include <utility>
 #include <vector>
-#include <unordered_set>
-#include <random>
+#include "Grafo.h"
 #include "Individuo.h"
+#include "Rng.h"
 
 /**
  * @brief Clase con funcionalidad de heurística greedy para seeding
  */
 class Greedy {
 public:
+    /**
+     * @brief Nodos vivos agrupados por grado actual (listas doblemente
+     *        enlazadas): recorrido en orden de grado y cambio de grado en O(1)
+     */
+    struct ColasPorGrado {
+        std::vector<int> cabeza;  // cabeza[d] = primer nodo con grado d (-1 si vacío)
+        std::vector<int> sig;
+        std::vector<int> ant;
+        int dmin = 0;
+
+        void insertar(int v, int d) {
+            ant[v] = -1;
+            sig[v] = cabeza[d];
+            if (cabeza[d] != -1) ant[cabeza[d]] = v;
+            cabeza[d] = v;
+            if (d < dmin) dmin = d;
+        }
+
+        void quitar(int v, int d) {
+            if (ant[v] != -1) sig[ant[v]] = sig[v];
+            else cabeza[d] = sig[v];
+            if (sig[v] != -1) ant[sig[v]] = ant[v];
+        }
+    };
+
+    /**
+     * @brief Estado inicial derivado del grafo (grados y colas por grado)
+     *
+     * Es el mismo para todas las soluciones: se arma una vez y los hilos
+     * lo comparten solo para lectura.
+     */
+    struct Base {
+        const Grafo& grafo;
+        std::vector<int> grado;
+        ColasPorGrado colas;
+
+        explicit Base(const Grafo& grafo);
+    };
+
+    /**
+     * @brief Memoria de trabajo de un hilo, reutilizada entre soluciones
+     */
+    struct Espacio {
+        std::vector<int> grado;
+        ColasPorGrado colas;
+        std::vector<char> quitado;
+        std::vector<int> solucion;
+        std::vector<int> orden;
+        std::vector<std::pair<int, int>> rcl;  // (a, b), b = -1 para candidatos simples
+        std::vector<int> quitados;
+        std::vector<std::tuple<int, int, int>> pares;
+    };
+
+    /**
+     * @brief generarSolucion() a partir de un estado ya armado
+     *
+     * Copia el estado inicial de 'base' en 'espacio' (sin asignar memoria
+     * después de la primera vez) y produce la misma solución que
+     * generarSolucion() con el mismo generador.
+     * @return Nodos del conjunto independiente (vive en 'espacio')
+     */
+    static const std::vector<int>& generar(const Base& base, Espacio& espacio, int k, Rng& gen);
+
     /**
      * @brief Genera una solución usando heurística greedy semi-aleatoria
-     * @param adj Lista de adyacencia
-     * @param adj_set Set de adyacencia
+     *
+     * En cada paso elige al azar entre los k mejores candidatos: nodos
+     * (clave = grado actual) o pares no adyacentes (clave = promedio de
+     * grados). Los candidatos se obtienen de colas por grado y un heap de
+     * pares, sin matriz de adyacencia ni lista completa de pares.
+     *
+     * @param grafo Grafo en formato CSR
      * @param k Parámetro de aleatoriedad (menor = más aleatorio)
      * @param gen Generador de números aleatorios
      * @return Vector con los nodos del conjunto independiente
      */
     static std::vector<int> generarSolucion(
-        const std::vector<std::vector<int>>& adj,
+        const Grafo& grafo,
         int k,
-        std::mt19937& gen
+        Rng& gen
     );
 
     /**
      * @brief Crea un individuo usando la heurística greedy
-     * @param adj Lista de adyacencia
-     * @param adj_set Set de adyacencia
+     * @param grafo Grafo en formato CSR
      * @param k Parámetro de aleatoriedad
      * @param gen Generador de números aleatorios
      * @return Individuo con solución greedy
      */
     static Individuo crearIndividuo(
-        const std::vector<std::vector<int>>& adj,
+        const Grafo& grafo,
         int k,
-        std::mt19937& gen
+        Rng& gen
     );
 };
 
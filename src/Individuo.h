@@ -1,17 +1,17 @@
 #ifndef INDIVIDUO_H
 #define INDIVIDUO_H
 
-#include <vector>
+#include "Cromosoma.h"
 
 /**
  * @brief Estructura que representa un individuo en el algoritmo genético
  * 
- * Usa una representación binaria donde:
+ * Usa una representación binaria empaquetada (ver Cromosoma.h) donde:
  * - cromosoma[i] = true  -> el nodo i está en la solución
  * - cromosoma[i] = false -> el nodo i NO está en la solución
  */
 struct Individuo {
-    std::vector<bool> cromosoma;
+    Cromosoma cromosoma;
     int fitness; // Tamaño del conjunto independiente (después de reparar)
 
     // Constructor
@@ -0,0 +1,120 @@
+#include "Lote.h"
+#include "AlgoritmoGenetico.h"
+#include "Argumentos.h"
+#include "CacheGrafos.h"
+#include "PoolHilos.h"
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+
+bool Lote::leerManifiesto(
+    const std::string& ruta,
+    const ParametrosGA& base,
+    std::vector<Trabajo>& trabajos
+) {
+    std::ifstream in(ruta);
+    if (!in) return false;
+
+    // Las corridas del lote comparten proceso: nada de --stats ni modos anidados
+    static const std::vector<std::string> PROHIBIDAS = {"--stats", "--batch", "--serve"};
+
+    std::string linea;
+    int num_linea = 0;
+    while (std::getline(in, linea)) {
+        ++num_linea;
+        std::vector<std::string> args = Argumentos::separar(linea);
+        if (args.empty() || args[0][0] == '#') continue;
+
+        Trabajo trabajo{num_linea, base, ""};
+        std::string prohibida = Argumentos::buscarOpcion(args, PROHIBIDAS);
+        ResultadoArgs r = Argumentos::parsear(args, trabajo.params, trabajo.error);
+        if (r == ResultadoArgs::AYUDA) {
+            trabajo.error = "opción -h no válida en un manifiesto";
+        } else if (!prohibida.empty()) {
+            trabajo.error = "opción " + prohibida + " no válida en un manifiesto";
+        } else if (r == ResultadoArgs::OK) {
+            if (trabajo.params.instancia.empty()) {
+                trabajo.error = "falta -i <archivo>";
+            } else if (trabajo.params.max_time <= 0) {
+                trabajo.error = "tiempo inválido";
+            }
+        }
+        trabajos.push_back(trabajo);
+    }
+    return true;
+}
+
+int Lote::ejecutar(
+    const std::string& ruta,
+    const ParametrosGA& base,
+    int paralelas,
+    std::ostream& out
+) {
+    std::vector<Trabajo> trabajos;
+    if (!leerManifiesto(ruta, base, trabajos)) {
+        std::cerr << "Error: No se pudo abrir el manifiesto " << ruta << std::endl;
+        return 1;
+    }
+
+    int total = static_cast<int>(trabajos.size());
+    std::vector<std::string> lineas(total);
+    std::vector<char> listo(total, 0);
+    int siguiente_impresion = 0;
+    bool hubo_error = false;
+    std::mutex mutex_salida;
+
+    CacheGrafos grafos;
+    std::atomic<int> siguiente{0};
+
+    out << "# trabajo\tinstancia\tseed\tcalidad\ttiempo\tgeneraciones\tevaluaciones" << std::endl;
+
+    PoolHilos pool(std::max(1, std::min(paralelas, total)));
+    pool.ejecutar([&](int) {
+        // El reporte any-time de cada corrida se descarta
+        std::ostream nulo(nullptr);
+
+        for (int t = siguiente++; t < total; t = siguiente++) {
+            const Trabajo& trabajo = trabajos[t];
+            std::ostringstream linea;
+            linea << t << '\t' << trabajo.params.instancia << '\t' << trabajo.params.seed << '\t';
+
+            bool ok = false;
+            if (!trabajo.error.empty()) {
+                linea << "ERROR\tlínea " << trabajo.linea << ": " << trabajo.error;
+            } else {
+                std::shared_ptr<const Grafo> grafo =
+                    grafos.obtener(trabajo.params.instancia, trabajo.params.usar_cache);
+                if (!grafo) {
+                    linea << "ERROR\tno se pudo cargar el grafo";
+                } else {
+                    ResultadoGA resultado = AlgoritmoGenetico::resolver(*grafo, trabajo.params, nulo);
+                    if (!resultado.error.empty()) {
+                        linea << "ERROR\t" << resultado.error;
+                    } else {
+                        linea << resultado.mejor.fitness << '\t'
+                              << std::fixed << std::setprecision(4) << resultado.tiempo_total << '\t'
+                              << resultado.generaciones << '\t' << resultado.evaluaciones;
+                        ok = true;
+                    }
+                }
+            }
+
+            // Se imprime el prefijo del manifiesto que ya está completo
+            std::lock_guard<std::mutex> lock(mutex_salida);
+            lineas[t] = linea.str();
+            listo[t] = 1;
+            if (!ok) hubo_error = true;
+            while (siguiente_impresion < total && listo[siguiente_impresion]) {
+                out << lineas[siguiente_impresion] << std::endl;
+                lineas[siguiente_impresion].clear();
+                ++siguiente_impresion;
+            }
+        }
+    });
+
+    return hubo_error ? 1 : 0;
+}
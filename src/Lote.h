@@ -0,0 +1,62 @@
+#ifndef LOTE_H
+#define LOTE_H
+
+#include <ostream>
+#include <string>
+#include <vector>
+#include "Parametros.h"
+
+/**
+ * @brief Modo lote: varias corridas del GA en un solo proceso
+ *
+ * Cada línea del manifiesto describe una corrida con las mismas opciones
+ * de la línea de comandos (p. ej. "-i g.graph -t 5 --seed 3"); las líneas
+ * vacías y las que empiezan con '#' se ignoran. Las opciones de la línea
+ * de comandos sirven de valores base y cada línea las sobrescribe.
+ *
+ * Los grafos se cargan una sola vez (CacheGrafos) y se comparten entre
+ * corridas; hasta 'trabajos' corridas avanzan en paralelo. Los resultados
+ * se escriben en el orden del manifiesto, cada uno apenas están listos los
+ * anteriores.
+ */
+class Lote {
+public:
+    struct Trabajo {
+        int linea;               // número de línea en el manifiesto
+        ParametrosGA params;
+        std::string error;       // no vacío si la línea no se pudo interpretar
+    };
+
+    /**
+     * @brief Lee el manifiesto
+     * @param ruta Archivo del manifiesto
+     * @param base Parámetros base de cada corrida
+     * @param trabajos Corridas leídas (incluye las líneas con error)
+     * @return false si el archivo no se pudo abrir
+     */
+    static bool leerManifiesto(
+        const std::string& ruta,
+        const ParametrosGA& base,
+        std::vector<Trabajo>& trabajos
+    );
+
+    /**
+     * @brief Corre el lote y escribe una línea TSV por corrida
+     *
+     * Columnas: trabajo, instancia, seed, calidad, tiempo, generaciones,
+     * evaluaciones. Una corrida fallida escribe "ERROR" y el motivo.
+     * @param ruta Archivo del manifiesto
+     * @param base Parámetros base de cada corrida
+     * @param paralelas Corridas simultáneas
+     * @param out Flujo para los resultados
+     * @return 0 si todas las corridas terminaron, 1 si alguna falló
+     */
+    static int ejecutar(
+        const std::string& ruta,
+        const ParametrosGA& base,
+        int paralelas,
+        std::ostream& out
+    );
+};
+
+#endif // LOTE_H
@@ -0,0 +1,61 @@
+#include "MonticuloPoblacion.h"
+
+template <bool MAXIMOS>
+bool MonticuloPoblacion::antes(int a, int b) const {
+    int fa = poblacion->fitness(a), fb = poblacion->fitness(b);
+    if (fa != fb) return MAXIMOS ? fa > fb : fa < fb;
+    return a < b;
+}
+
+template <bool MAXIMOS>
+void MonticuloPoblacion::subir(Lado& lado, int k) {
+    int fila = lado.filas[k];
+    while (k > 0) {
+        int padre = (k - 1) / 2;
+        if (!antes<MAXIMOS>(fila, lado.filas[padre])) break;
+        lado.filas[k] = lado.filas[padre];
+        lado.posicion[lado.filas[k]] = k;
+        k = padre;
+    }
+    lado.filas[k] = fila;
+    lado.posicion[fila] = k;
+}
+
+template <bool MAXIMOS>
+void MonticuloPoblacion::bajar(Lado& lado, int k) {
+    int tam = static_cast<int>(lado.filas.size());
+    int fila = lado.filas[k];
+    while (true) {
+        int hijo = 2 * k + 1;
+        if (hijo >= tam) break;
+        if (hijo + 1 < tam && antes<MAXIMOS>(lado.filas[hijo + 1], lado.filas[hijo])) hijo++;
+        if (!antes<MAXIMOS>(lado.filas[hijo], fila)) break;
+        lado.filas[k] = lado.filas[hijo];
+        lado.posicion[lado.filas[k]] = k;
+        k = hijo;
+    }
+    lado.filas[k] = fila;
+    lado.posicion[fila] = k;
+}
+
+void MonticuloPoblacion::construir(const Poblacion& p) {
+    poblacion = &p;
+    int tam = p.tamano();
+    for (Lado* lado : {&maximos, &minimos}) {
+        lado->filas.resize(tam);
+        lado->posicion.resize(tam);
+        for (int i = 0; i < tam; ++i) lado->filas[i] = lado->posicion[i] = i;
+    }
+    for (int k = tam / 2 - 1; k >= 0; --k) {
+        bajar<true>(maximos, k);
+        bajar<false>(minimos, k);
+    }
+}
+
+void MonticuloPoblacion::actualizar(int i) {
+    // Solo una de las dos direcciones mueve la fila; la otra sale enseguida
+    subir<true>(maximos, maximos.posicion[i]);
+    bajar<true>(maximos, maximos.posicion[i]);
+    subir<false>(minimos, minimos.posicion[i]);
+    bajar<false>(minimos, minimos.posicion[i]);
+}
@@ -0,0 +1,57 @@
+#ifndef MONTICULO_POBLACION_H
+#define MONTICULO_POBLACION_H
+
+#include <vector>
+#include "Poblacion.h"
+
+/**
+ * @brief Mejor y peor fila de una población, mantenidos al reemplazar filas
+ *
+ * Dos montículos binarios indexados sobre las filas (uno de máximos y uno
+ * de mínimos por fitness) con la posición de cada fila en cada uno: mejor()
+ * y peor() son O(1) y actualizar() tras cambiar una fila es O(log pop).
+ * Los empates se desempatan por índice de fila, así que mejor() y peor()
+ * coinciden con Poblacion::indiceMejor() e indicePeor(). Toda la memoria se
+ * reserva en construir().
+ */
+class MonticuloPoblacion {
+public:
+    /**
+     * @brief Indexa todas las filas de 'poblacion' en O(pop)
+     *
+     * La población debe sobrevivir al montículo y no cambiar de tamaño.
+     */
+    void construir(const Poblacion& poblacion);
+
+    bool vacio() const { return maximos.filas.empty(); }
+
+    int mejor() const { return maximos.filas[0]; }
+    int peor() const { return minimos.filas[0]; }
+
+    /**
+     * @brief Reubica la fila i después de que cambió su fitness
+     */
+    void actualizar(int i);
+
+private:
+    struct Lado {
+        std::vector<int> filas;     // el montículo
+        std::vector<int> posicion;  // posición de cada fila en 'filas'
+    };
+
+    // ¿Va la fila a antes que la b? (máximos: mayor fitness; mínimos: menor)
+    template <bool MAXIMOS>
+    bool antes(int a, int b) const;
+
+    template <bool MAXIMOS>
+    void subir(Lado& lado, int k);
+
+    template <bool MAXIMOS>
+    void bajar(Lado& lado, int k);
+
+    const Poblacion* poblacion = nullptr;
+    Lado maximos;
+    Lado minimos;
+};
+
+#endif // MONTICULO_POBLACION_H
@@ -0,0 +1,458 @@
+#include "MotorGA.h"
+#include "Greedy.h"
+#include "Operadores.h"
+#include "Telemetria.h"
+#include "Zobrist.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <numeric>
+
+MotorGA::MotorGA(
+    const Grafo& grafo,
+    const ParametrosGA& params,
+    int tam_poblacion,
+    uint64_t semilla,
+    int num_hilos
+)
+    : grafo(grafo),
+      params(params),
+      actual(tam_poblacion, grafo.n),
+      siguiente(tam_poblacion, grafo.n),
+      descarte(std::max(1, num_hilos), grafo.n),
+      crias(params.modelo == ModeloGA::ESTACIONARIO ? 2 * std::max(1, num_hilos) : 0, grafo.n),
+      pendientes(std::max(1, num_hilos), grafo.n),
+      originales(params.cache_evaluaciones > 0 ? std::max(1, num_hilos) : 0, grafo.n),
+      pool(std::max(1, num_hilos)),
+      num_pares((tam_poblacion + 1) / 2),
+      num_generaciones(0),
+      num_evaluaciones(0),
+      cache_activa(false),
+      generaciones_pausa(0) {
+    gens.reserve(pool.tamano());
+    gens.emplace_back(params.rng, semilla);
+    for (int h = 1; h < pool.tamano(); ++h) {
+        gens.push_back(Rng::flujo(params.rng, semilla, h));
+    }
+    if (params.busqueda_local) {
+        busquedas.reserve(pool.tamano());
+        for (int h = 0; h < pool.tamano(); ++h) busquedas.emplace_back(grafo);
+    }
+    double presupuesto = params.presupuesto_bl * (grafo.n + 2.0 * grafo.numAristas());
+    presupuesto_hilo = static_cast<long long>(presupuesto / pool.tamano());
+    if (params.cache_evaluaciones > 0) {
+        cache.reset(new CacheEvaluaciones(params.cache_evaluaciones, actual.numPalabras()));
+        contadores_cache.resize(pool.tamano());
+    }
+    torneos.resize(pool.tamano());
+    presupuestos.resize(pool.tamano());
+    tarea_bloque = [this](int id) { generarBloque(id); };
+    tarea_crias = [this](int id) { generarCrias(id); };
+}
+
+void MotorGA::inicializar() {
+    if (grafo.n == 0) return;
+
+    CronometroFases crono;
+    sembrar(0, actual.tamano());
+    indexar();
+    crono.marcar(Fase::SEEDING);
+}
+
+void MotorGA::indexar() {
+    if (params.modelo == ModeloGA::ESTACIONARIO) monticulo.construir(actual);
+}
+
+int MotorGA::indiceMejor() const {
+    return monticulo.vacio() ? actual.indiceMejor() : monticulo.mejor();
+}
+
+int MotorGA::indicePeor() const {
+    return monticulo.vacio() ? actual.indicePeor() : monticulo.peor();
+}
+
+void MotorGA::reiniciar(int elite) {
+    int pop_size = actual.tamano();
+    if (grafo.n == 0) return;
+    elite = std::max(0, std::min(elite, pop_size));
+
+    CronometroFases crono;
+    std::vector<int> indices(pop_size);
+    std::iota(indices.begin(), indices.end(), 0);
+    std::partial_sort(indices.begin(), indices.begin() + elite, indices.end(),
+                      [&](int a, int b) { return actual.fitness(a) > actual.fitness(b); });
+
+    // La élite pasa a las primeras filas (a través de 'siguiente', que se
+    // sobrescribe entera en la próxima generación)
+    for (int k = 0; k < elite; ++k) siguiente.copiarDesde(k, actual, indices[k]);
+    for (int k = 0; k < elite; ++k) actual.copiarDesde(k, siguiente, k);
+    sembrar(elite, pop_size);
+    indexar();
+
+    // Las filas nuevas no tienen hash: se recalculan si la cache vuelve
+    cache_activa = false;
+    generaciones_pausa = 0;
+    crono.marcar(Fase::SEEDING);
+}
+
+void MotorGA::sembrar(int desde, int hasta) {
+    int n_greedy = static_cast<int>((hasta - desde) * params.seeding_rate);
+    if (n_greedy > 0 && !base_greedy) {
+        base_greedy.reset(new Greedy::Base(grafo));
+        espacios_greedy.resize(pool.tamano());
+    }
+
+    // Cada fila tiene su propio flujo, derivado de un único número del
+    // generador 0: la población no depende del número de hilos ni del
+    // orden en que se reparten las filas
+    uint64_t semilla = gens[0]();
+    size_t num_palabras = actual.numPalabras();
+    uint64_t mascara_ultima = (grafo.n & 63) ? (1ULL << (grafo.n & 63)) - 1 : ~0ULL;
+    std::atomic<int> proxima(desde);
+
+    pool.ejecutar([&](int id) {
+        // Reparto dinámico: una fila greedy cuesta mucho más que una aleatoria
+        for (int i = proxima++; i < hasta; i = proxima++) {
+            Rng gen = Rng::flujo(params.rng, semilla, static_cast<uint64_t>(i));
+            uint64_t* w = actual.cromosoma(i);
+            actual.hash(i) = 0;
+            if (i < desde + n_greedy) {
+                // Individuo greedy
+                const std::vector<int>& solucion =
+                    Greedy::generar(*base_greedy, espacios_greedy[id], params.k_greedy, gen);
+                std::fill(w, w + num_palabras, 0ULL);
+                for (int u : solucion) w[u >> 6] |= 1ULL << (u & 63);
+                actual.fitness(i) = static_cast<int>(solucion.size());
+            } else {
+                // Individuo aleatorio (cada bit con probabilidad 1/2), reparado
+                gen.llenar(w, num_palabras);
+                w[num_palabras - 1] &= mascara_ultima;
+                actual.fitness(i) = Operadores::reparar(w, num_palabras, grafo);
+            }
+        }
+    });
+
+    num_evaluaciones += hasta - desde;
+}
+
+void MotorGA::calcularHashes() {
+    if (!cache) return;
+    for (int i = 0; i < actual.tamano(); ++i) {
+        actual.hash(i) = Zobrist::hash(actual.cromosoma(i), actual.numPalabras());
+    }
+}
+
+EstadisticasCache MotorGA::estadisticasCache() const {
+    EstadisticasCache total;
+    if (!cache) return total;
+    for (const ContadoresCache& c : contadores_cache) total.sumar(c.e);
+    total.entradas = cache->capacidad();
+    return total;
+}
+
+void MotorGA::guardarEstado(EstadoGA& estado) const {
+    int pop_size = actual.tamano();
+    size_t num_palabras = actual.numPalabras();
+    estado.n = grafo.n;
+    estado.num_aristas = grafo.numAristas();
+    estado.pop_size = pop_size;
+    estado.num_hilos = pool.tamano();
+    estado.rng = params.rng;
+    estado.seed = params.seed;
+    estado.orden = params.orden;
+    estado.generaciones = num_generaciones;
+    estado.evaluaciones = num_evaluaciones;
+    estado.num_palabras = num_palabras;
+
+    // Sin el relleno de las filas de la arena
+    estado.cromosomas.resize(static_cast<size_t>(pop_size) * num_palabras);
+    for (int i = 0; i < pop_size; ++i) {
+        std::copy(actual.cromosoma(i), actual.cromosoma(i) + num_palabras,
+                  estado.cromosomas.begin() + static_cast<size_t>(i) * num_palabras);
+    }
+    estado.fitness = actual.fitnesses();
+
+    estado.estados_rng.resize(gens.size());
+    for (size_t h = 0; h < gens.size(); ++h) gens[h].guardarEstado(estado.estados_rng[h]);
+}
+
+bool MotorGA::restaurarEstado(const EstadoGA& estado, std::string& error) {
+    int pop_size = actual.tamano();
+    size_t num_palabras = actual.numPalabras();
+    if (estado.n != grafo.n || estado.num_aristas != grafo.numAristas()) {
+        error = "el checkpoint es de otro grafo";
+        return false;
+    }
+    if (estado.pop_size != pop_size || estado.num_hilos != pool.tamano() || estado.rng != params.rng) {
+        error = "el checkpoint se generó con otro pop_size, número de hilos o generador";
+        return false;
+    }
+    if (estado.seed != params.seed) {
+        auto semilla = [](int seed) {
+            return seed < 0 ? std::string("sin --seed") : "con --seed " + std::to_string(seed);
+        };
+        error = "el checkpoint se generó " + semilla(estado.seed) + " y la corrida es " +
+                semilla(params.seed);
+        return false;
+    }
+    if (estado.orden != params.orden) {
+        // La población está numerada según el orden con que se escribió
+        error = "el checkpoint se generó con otro --order";
+        return false;
+    }
+    for (size_t h = 0; h < gens.size(); ++h) {
+        if (!gens[h].cargarEstado(estado.estados_rng[h])) {
+            error = "estado de generador inválido en el checkpoint";
+            return false;
+        }
+    }
+
+    for (int i = 0; i < pop_size; ++i) {
+        const uint64_t* fila = estado.cromosomas.data() + static_cast<size_t>(i) * num_palabras;
+        std::copy(fila, fila + num_palabras, actual.cromosoma(i));
+        actual.fitness(i) = estado.fitness[i];
+    }
+    num_generaciones = estado.generaciones;
+    num_evaluaciones = estado.evaluaciones;
+    cache_activa = false;
+    indexar();
+    return true;
+}
+
+void MotorGA::generacion() {
+    if (params.modelo == ModeloGA::ESTACIONARIO) {
+        generacionEstacionaria();
+        return;
+    }
+
+    // La cache se apaga unas generaciones cuando casi no acierta: mantener
+    // los hashes y consultar cuesta más que reparar hijos que no se repiten
+    EstadisticasCache antes;
+    if (cache) {
+        bool activa = (generaciones_pausa == 0);
+        if (!activa) generaciones_pausa--;
+        if (activa && !cache_activa) calcularHashes();
+        cache_activa = activa;
+        antes = estadisticasCache();
+    }
+
+    pool.ejecutar(tarea_bloque);
+
+    if (cache_activa) {
+        EstadisticasCache despues = estadisticasCache();
+        long long consultas = despues.consultas - antes.consultas;
+        long long aciertos = (despues.aciertos + despues.aciertos_padre) - (antes.aciertos + antes.aciertos_padre);
+        if (aciertos * 100 < consultas * TASA_MINIMA_CACHE) generaciones_pausa = PAUSA_CACHE;
+    }
+    actual.swap(siguiente);
+    num_generaciones++;
+    num_evaluaciones += actual.tamano();
+}
+
+void MotorGA::generacionEstacionaria() {
+    EstadisticasCache antes;
+    if (cache) {
+        bool activa = (generaciones_pausa == 0);
+        if (!activa) generaciones_pausa--;
+        if (activa && !cache_activa) calcularHashes();
+        cache_activa = activa;
+        antes = estadisticasCache();
+    }
+    std::fill(presupuestos.begin(), presupuestos.end(), presupuesto_hilo);
+
+    // Pasos de un par por hilo hasta producir al menos pop_size hijos; los
+    // hijos de un paso se insertan uno por uno, en orden de hilo
+    int hilos = pool.tamano();
+    int pasos = (num_pares + hilos - 1) / hilos;
+    for (int paso = 0; paso < pasos; ++paso) {
+        pool.ejecutar(tarea_crias);
+        CronometroFases crono;
+        for (int c = 0; c < 2 * hilos; ++c) insertarCria(c);
+        crono.marcar(Fase::REEMPLAZO);
+    }
+
+    if (cache_activa) {
+        EstadisticasCache despues = estadisticasCache();
+        long long consultas = despues.consultas - antes.consultas;
+        long long aciertos = (despues.aciertos + despues.aciertos_padre) - (antes.aciertos + antes.aciertos_padre);
+        if (aciertos * 100 < consultas * TASA_MINIMA_CACHE) generaciones_pausa = PAUSA_CACHE;
+    }
+    num_generaciones++;
+    num_evaluaciones += 2LL * pasos * hilos;
+}
+
+void MotorGA::insertarCria(int c) {
+    // Reemplazo del peor: el hijo entra si no es peor que él
+    int peor = monticulo.peor();
+    if (crias.fitness(c) < actual.fitness(peor)) return;
+    bool mejora = crias.fitness(c) > actual.fitness(monticulo.mejor());
+    actual.copiarDesde(peor, crias, c);
+    monticulo.actualizar(peor);
+    if (mejora && al_mejorar) al_mejorar(peor);
+}
+
+void MotorGA::reemplazar(int fila, const Poblacion& origen, int i) {
+    actual.copiarDesde(fila, origen, i);
+    if (!monticulo.vacio()) monticulo.actualizar(fila);
+}
+
+void MotorGA::generarBloque(int id) {
+    Rng& gen = gens[id];
+    int pop_size = actual.tamano();
+    int inicio, fin;
+    PoolHilos::rango(num_pares, id, pool.tamano(), inicio, fin);
+    long long presupuesto = presupuesto_hilo;
+    CronometroFases crono(16);  // se cronometra un par de cada 16
+
+    // Los candidatos de todos los torneos del bloque, sorteados de una vez:
+    // es la mayor parte de la selección, se cuenta entera
+    std::vector<int>& candidatos = torneos[id];
+    candidatos.resize(4 * static_cast<size_t>(std::max(0, fin - inicio)));
+    gen.indices(candidatos.data(), candidatos.size(), static_cast<uint32_t>(pop_size));
+    crono.sumar(Fase::SELECCION);
+
+    for (int p = inicio; p < fin; ++p) {
+        crono.reiniciar();
+        const int* torneo = &candidatos[4 * static_cast<size_t>(p - inicio)];
+        producirPar(id, torneo, siguiente, 2 * p, 2 * p + 1 < pop_size, presupuesto, crono);
+    }
+}
+
+void MotorGA::generarCrias(int id) {
+    Rng& gen = gens[id];
+    CronometroFases crono;
+    int torneo[4];
+    gen.indices(torneo, 4, static_cast<uint32_t>(actual.tamano()));
+    producirPar(id, torneo, crias, 2 * id, true, presupuestos[id], crono);
+}
+
+void MotorGA::producirPar(int id, const int* torneo, Poblacion& destino, int fila1, bool segundo_valido,
+                          long long& presupuesto, CronometroFases& crono) {
+    Rng& gen = gens[id];
+    size_t num_palabras = actual.numPalabras();
+
+    // Selección (por índice, sin copiar padres)
+    int padre1 = Operadores::mejorDelTorneo(actual.fitnesses().data(), torneo);
+    int padre2 = Operadores::mejorDelTorneo(actual.fitnesses().data(), torneo + 2);
+    crono.marcar(Fase::SELECCION);
+
+    uint64_t* hijo1 = destino.cromosoma(fila1);
+    uint64_t* hijo2 = segundo_valido ? destino.cromosoma(fila1 + 1) : descarte.cromosoma(id);
+
+    // Cruce y mutación (con cache, manteniendo el hash de cada hijo)
+    uint64_t hash1 = 0, hash2 = 0;
+    if (cache_activa) {
+        hash1 = actual.hash(padre1);
+        hash2 = actual.hash(padre2);
+        Operadores::cruzar(actual.cromosoma(padre1), actual.cromosoma(padre2),
+                           hijo1, hijo2, num_palabras, params.p_cruce, gen, hash1, hash2);
+        crono.marcar(Fase::CRUCE);
+        Operadores::mutar(hijo1, grafo.n, params.p_mut, gen, hash1);
+        Operadores::mutar(hijo2, grafo.n, params.p_mut, gen, hash2);
+        crono.marcar(Fase::MUTACION);
+    } else {
+        Operadores::cruzar(actual.cromosoma(padre1), actual.cromosoma(padre2),
+                           hijo1, hijo2, num_palabras, params.p_cruce, gen);
+        crono.marcar(Fase::CRUCE);
+        Operadores::mutar(hijo1, grafo.n, params.p_mut, gen);
+        Operadores::mutar(hijo2, grafo.n, params.p_mut, gen);
+        crono.marcar(Fase::MUTACION);
+    }
+
+    if (cache_activa) {
+        destino.fitness(fila1) = evaluarConCache(id, hijo1, hash1, padre1, padre2);
+        destino.hash(fila1) = hash1;
+        if (segundo_valido) {
+            destino.fitness(fila1 + 1) = evaluarConCache(id, hijo2, hash2, padre1, padre2);
+            destino.hash(fila1 + 1) = hash2;
+        }
+        crono.marcar(Fase::REPARACION);
+    } else {
+        if (cache) contadores_cache[id].e.pausadas += segundo_valido ? 2 : 1;
+
+        // Evaluación delta respecto del padre más parecido
+        const uint64_t* c1 = actual.cromosoma(padre1);
+        const uint64_t* c2 = actual.cromosoma(padre2);
+        int f1 = actual.fitness(padre1);
+        int f2 = actual.fitness(padre2);
+        uint64_t* buffer = pendientes.cromosoma(id);
+        destino.fitness(fila1) = Operadores::repararDesdePadres(
+            hijo1, c1, f1, c2, f2, num_palabras, grafo, buffer);
+        if (segundo_valido) {
+            destino.fitness(fila1 + 1) = Operadores::repararDesdePadres(
+                hijo2, c1, f1, c2, f2, num_palabras, grafo, buffer);
+        }
+        crono.marcar(Fase::REPARACION);
+    }
+
+    // Búsqueda local, hasta agotar el presupuesto del hilo
+    if (!busquedas.empty() && presupuesto > 0) {
+        BusquedaLocal& bl = busquedas[id];
+        destino.fitness(fila1) = bl.mejorar(hijo1, destino.fitness(fila1), presupuesto);
+        if (segundo_valido) {
+            destino.fitness(fila1 + 1) = bl.mejorar(hijo2, destino.fitness(fila1 + 1), presupuesto);
+        }
+        if (cache_activa) {
+            // La búsqueda local mueve genes: el hash se recalcula entero
+            destino.hash(fila1) = Zobrist::hash(hijo1, num_palabras);
+            if (segundo_valido) destino.hash(fila1 + 1) = Zobrist::hash(hijo2, num_palabras);
+        }
+        crono.marcar(Fase::BUSQUEDA_LOCAL);
+    }
+}
+
+int MotorGA::evaluarConCache(int id, uint64_t* hijo, uint64_t& hash, int padre1, int padre2) {
+    using Reloj = std::chrono::steady_clock;
+    EstadisticasCache& stats = contadores_cache[id].e;
+    size_t num_palabras = actual.numPalabras();
+    const size_t bytes = num_palabras * sizeof(uint64_t);
+
+    // Los tiempos se toman en uno de cada MUESTREO_TIEMPO hijos
+    bool medir = (stats.consultas % MUESTREO_TIEMPO) == 0;
+    Reloj::time_point t0, t1, t2;
+    if (medir) t0 = Reloj::now();
+    auto acumular = [&](double& destino, Reloj::time_point desde, Reloj::time_point hasta) {
+        destino += MUESTREO_TIEMPO * std::chrono::duration<double>(hasta - desde).count();
+    };
+    stats.consultas++;
+
+    // Copia exacta de un padre: ya es un conjunto independiente
+    for (int padre : {padre1, padre2}) {
+        if (hash == actual.hash(padre) && std::memcmp(hijo, actual.cromosoma(padre), bytes) == 0) {
+            stats.aciertos_padre++;
+            if (medir) acumular(stats.segundos_cache, t0, Reloj::now());
+            return actual.fitness(padre);
+        }
+    }
+
+    int fitness;
+    uint64_t hash_reparado;
+    if (cache->buscar(hash, hijo, fitness, hash_reparado)) {
+        stats.aciertos++;
+        hash = hash_reparado;
+        if (medir) acumular(stats.segundos_cache, t0, Reloj::now());
+        return fitness;
+    }
+
+    uint64_t* original = originales.cromosoma(id);
+    std::memcpy(original, hijo, bytes);
+    if (medir) t1 = Reloj::now();
+    fitness = Operadores::repararDesdePadres(
+        hijo, actual.cromosoma(padre1), actual.fitness(padre1),
+        actual.cromosoma(padre2), actual.fitness(padre2),
+        num_palabras, grafo, pendientes.cromosoma(id));
+    if (medir) t2 = Reloj::now();
+
+    // La reparación solo apaga genes: el hash cambia en las palabras tocadas
+    hash_reparado = hash ^ Zobrist::hashDiferencia(original, hijo, num_palabras);
+    cache->insertar(hash, original, hijo, fitness, hash_reparado);
+    hash = hash_reparado;
+
+    if (medir) {
+        acumular(stats.segundos_reparacion, t1, t2);
+        acumular(stats.segundos_cache, t0, t1);
+        acumular(stats.segundos_cache, t2, Reloj::now());
+    }
+    return fitness;
+}
@@ -0,0 +1,226 @@
+#ifndef MOTOR_GA_H
+#define MOTOR_GA_H
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+#include "BusquedaLocal.h"
+#include "CacheEvaluaciones.h"
+#include "Checkpoint.h"
+#include "Grafo.h"
+#include "Greedy.h"
+#include "MonticuloPoblacion.h"
+#include "Parametros.h"
+#include "PoolHilos.h"
+#include "Poblacion.h"
+#include "Rng.h"
+#include "Telemetria.h"
+
+/**
+ * @brief Motor generacional del GA sobre arenas de población
+ *
+ * Mantiene dos poblaciones preasignadas (actual y siguiente) que se
+ * intercambian en cada generación. La selección devuelve índices y el cruce
+ * y la mutación escriben directamente en las filas de la población
+ * siguiente, así que después de inicializar() una generación no hace
+ * ninguna asignación de memoria.
+ *
+ * Con params.cache_evaluaciones > 0 cada fila lleva su hash Zobrist, que
+ * el cruce y la mutación actualizan sobre la marcha; un hijo idéntico a
+ * un padre o a un cromosoma ya reparado (CacheEvaluaciones) no se repara.
+ * La población resultante es la misma que sin cache.
+ *
+ * Con params.modelo == ESTACIONARIO no hay población siguiente: cada hilo
+ * produce un par de hijos por paso y cada hijo reemplaza en el lugar al
+ * peor de la población si no es peor que él. Un MonticuloPoblacion da el
+ * mejor y el peor en O(1); una "generación" son los pasos necesarios para
+ * producir pop_size hijos.
+ */
+class MotorGA {
+public:
+    /**
+     * @param grafo Grafo de la instancia (debe sobrevivir al motor)
+     * @param params Parámetros (se copian)
+     * @param tam_poblacion Tamaño de la población
+     * @param semilla Semilla del hilo 0; el hilo h usa Rng::derivarSemilla(semilla, h)
+     * @param num_hilos Hilos para generar la descendencia
+     */
+    MotorGA(
+        const Grafo& grafo,
+        const ParametrosGA& params,
+        int tam_poblacion,
+        uint64_t semilla,
+        int num_hilos
+    );
+
+    MotorGA(const MotorGA&) = delete;
+    MotorGA& operator=(const MotorGA&) = delete;
+
+    /**
+     * @brief Crea la población inicial (greedy + aleatorios reparados, en
+     *        paralelo con los hilos del motor; no depende de cuántos son)
+     */
+    void inicializar();
+
+    /**
+     * @brief Ejecuta una generación completa (pop_size hijos) según params.modelo
+     */
+    void generacion();
+
+    /**
+     * @brief Se llama con la fila de cada hijo que supera al mejor de la
+     *        población en el momento de insertarlo (solo modelo estacionario)
+     *
+     * Corre en el hilo que llamó a generacion(), entre dos inserciones.
+     */
+    void alMejorar(std::function<void(int)> funcion) { al_mejorar = std::move(funcion); }
+
+    /**
+     * @brief Mejor y peor fila: O(1) con el modelo estacionario, O(pop) si no
+     */
+    int indiceMejor() const;
+    int indicePeor() const;
+
+    /**
+     * @brief Copia la fila i de 'origen' en 'fila' manteniendo el índice
+     *        de mejor y peor (p. ej. inmigrantes de otra isla)
+     */
+    void reemplazar(int fila, const Poblacion& origen, int i);
+
+    /**
+     * @brief Conserva los 'elite' mejores y vuelve a sembrar el resto
+     *
+     * Los sobrevivientes pasan a las primeras filas; las demás se llenan
+     * como en inicializar() (seeding_rate greedy, el resto aleatorio
+     * reparado).
+     */
+    void reiniciar(int elite);
+
+    /**
+     * @brief Copia población, contadores y generadores en 'estado'
+     *
+     * No toca los campos de la corrida (mejor solución, tiempo); sí anota
+     * params.seed y params.orden, que restaurarEstado() compara.
+     * Reutiliza la memoria de 'estado' si ya tiene el tamaño justo.
+     */
+    void guardarEstado(EstadoGA& estado) const;
+
+    /**
+     * @brief Reemplaza a inicializar(): continúa desde un estado guardado
+     * @param error Motivo si el estado no corresponde a este motor
+     */
+    bool restaurarEstado(const EstadoGA& estado, std::string& error);
+
+    Poblacion& poblacion() { return actual; }
+    const Poblacion& poblacion() const { return actual; }
+
+    long long generaciones() const { return num_generaciones; }
+    long long evaluaciones() const { return num_evaluaciones; }
+
+    /**
+     * @brief Aciertos y tiempos de la cache (entradas = 0 si está apagada)
+     */
+    EstadisticasCache estadisticasCache() const;
+
+private:
+    /**
+     * @brief Llena las filas [desde, hasta) de la población actual
+     *
+     * Las primeras seeding_rate · (hasta - desde) con el greedy y el resto
+     * aleatorias reparadas, repartidas entre los hilos del pool. El estado
+     * inicial del greedy se arma en la primera llamada y se comparte.
+     */
+    void sembrar(int desde, int hasta);
+
+    /**
+     * @brief Produce los pares [inicio, fin) asignados al hilo 'id'
+     *
+     * El par p escribe las filas 2p y 2p+1 de la población siguiente; si
+     * pop_size es impar, el segundo hijo del último par va a una fila de
+     * descarte del hilo.
+     */
+    void generarBloque(int id);
+
+    /**
+     * @brief Un paso del modelo estacionario: el hilo 'id' deja un par de
+     *        hijos en las filas 2·id y 2·id + 1 de 'crias'
+     */
+    void generarCrias(int id);
+
+    /**
+     * @brief Torneos, cruce, mutación, reparación y búsqueda local de un par
+     *
+     * Los hijos van a las filas fila1 y fila1 + 1 de 'destino' (el segundo
+     * a la fila de descarte del hilo si !segundo_valido), con fitness y,
+     * con la cache activa, hash.
+     * @param torneo Los cuatro candidatos de los dos torneos
+     */
+    void producirPar(int id, const int* torneo, Poblacion& destino, int fila1, bool segundo_valido,
+                     long long& presupuesto, CronometroFases& crono);
+
+    void generacionEstacionaria();
+
+    /**
+     * @brief Inserta la fila c de 'crias' en lugar del peor, si no es peor que él
+     */
+    void insertarCria(int c);
+
+    /**
+     * @brief Reconstruye el índice de mejor y peor (modelo estacionario)
+     */
+    void indexar();
+
+    /**
+     * @brief Repara un hijo pasando por la cache
+     * @param hash Entra con el hash del hijo sin reparar y sale con el del reparado
+     * @return Fitness del hijo
+     */
+    int evaluarConCache(int id, uint64_t* hijo, uint64_t& hash, int padre1, int padre2);
+
+    /**
+     * @brief Recalcula el hash de todas las filas de la población actual
+     */
+    void calcularHashes();
+
+    // Una generación con menos de TASA_MINIMA_CACHE % de aciertos apaga la
+    // cache (sin hashes ni consultas) durante las PAUSA_CACHE siguientes;
+    // al volver se recalculan los hashes de la población
+    static constexpr int TASA_MINIMA_CACHE = 2;
+    static constexpr int PAUSA_CACHE = 32;
+    static constexpr int MUESTREO_TIEMPO = 16;  // se cronometra un hijo de cada 16
+
+    struct alignas(64) ContadoresCache {
+        EstadisticasCache e;
+    };
+
+    const Grafo& grafo;
+    ParametrosGA params;
+    Poblacion actual;
+    Poblacion siguiente;
+    Poblacion descarte;    // una fila por hilo
+    Poblacion crias;       // dos filas por hilo (modelo estacionario)
+    MonticuloPoblacion monticulo;  // vacío con el modelo generacional
+    std::function<void(int)> al_mejorar;
+    Poblacion pendientes;  // buffer en cero de repararIncremental, una fila por hilo
+    std::vector<Rng> gens;
+    std::vector<std::vector<int>> torneos;  // candidatos de los torneos del bloque, por hilo
+    std::vector<long long> presupuestos;    // de búsqueda local en la generación, por hilo (estacionario)
+    std::vector<BusquedaLocal> busquedas;  // una por hilo, vacío sin --local_search
+    std::unique_ptr<Greedy::Base> base_greedy;     // compartida por los hilos al sembrar
+    std::vector<Greedy::Espacio> espacios_greedy;  // una por hilo
+    std::unique_ptr<CacheEvaluaciones> cache;  // nulo sin --eval_cache
+    Poblacion originales;                      // hijo sin reparar, una fila por hilo (con cache)
+    std::vector<ContadoresCache> contadores_cache;
+    long long presupuesto_hilo;            // presupuesto de búsqueda local por generación
+    PoolHilos pool;
+    std::function<void(int)> tarea_bloque;
+    std::function<void(int)> tarea_crias;
+    int num_pares;
+    long long num_generaciones;
+    long long num_evaluaciones;
+    bool cache_activa;        // en la generación en curso
+    int generaciones_pausa;   // generaciones que faltan con la cache apagada
+};
+
+#endif // MOTOR_GA_H
@@ -1,44 +1,406 @@
 #include "Operadores.h"
+#include "Zobrist.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
 
-void Operadores::reparar_y_evaluar(
-    Individuo& ind,
-    const std::vector<std::vector<int>>& adj_set
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define OPERADORES_X86 1
+#endif
+
+namespace {
+
+// ¿(a & b) != 0 en las primeras k palabras? Sale en el primer bloque con
+// intersección, que en la reparación suele llegar pronto.
+bool intersectaEscalar(const uint64_t* a, const uint64_t* b, size_t k) {
+    size_t i = 0;
+    for (; i + 4 <= k; i += 4) {
+        if ((a[i] & b[i]) | (a[i + 1] & b[i + 1]) |
+            (a[i + 2] & b[i + 2]) | (a[i + 3] & b[i + 3])) return true;
+    }
+    for (; i < k; ++i) {
+        if (a[i] & b[i]) return true;
+    }
+    return false;
+}
+
+#ifdef OPERADORES_X86
+__attribute__((target("sse4.1")))
+bool intersectaSse41(const uint64_t* a, const uint64_t* b, size_t k) {
+    size_t i = 0;
+    for (; i + 4 <= k; i += 4) {
+        __m128i x0 = _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i)),
+                                   _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i)));
+        __m128i x1 = _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i + 2)),
+                                   _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i + 2)));
+        __m128i x = _mm_or_si128(x0, x1);
+        if (!_mm_testz_si128(x, x)) return true;
+    }
+    for (; i < k; ++i) {
+        if (a[i] & b[i]) return true;
+    }
+    return false;
+}
+
+__attribute__((target("avx2")))
+bool intersectaAvx2(const uint64_t* a, const uint64_t* b, size_t k) {
+    size_t i = 0;
+    for (; i + 8 <= k; i += 8) {
+        __m256i x0 = _mm256_and_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i)),
+                                      _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i)));
+        __m256i x1 = _mm256_and_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i + 4)),
+                                      _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i + 4)));
+        __m256i x = _mm256_or_si256(x0, x1);
+        if (!_mm256_testz_si256(x, x)) return true;
+    }
+    for (; i < k; ++i) {
+        if (a[i] & b[i]) return true;
+    }
+    return false;
+}
+#endif
+
+using FuncionInterseca = bool (*)(const uint64_t*, const uint64_t*, size_t);
+
+bool soportado(NucleoSimd nucleo) {
+#ifdef OPERADORES_X86
+    __builtin_cpu_init();
+    switch (nucleo) {
+        case NucleoSimd::ESCALAR: return true;
+        case NucleoSimd::SSE41: return __builtin_cpu_supports("sse4.1");
+        case NucleoSimd::AVX2: return __builtin_cpu_supports("avx2");
+    }
+    return false;
+#else
+    return nucleo == NucleoSimd::ESCALAR;
+#endif
+}
+
+FuncionInterseca funcionDe(NucleoSimd nucleo) {
+#ifdef OPERADORES_X86
+    if (nucleo == NucleoSimd::AVX2) return intersectaAvx2;
+    if (nucleo == NucleoSimd::SSE41) return intersectaSse41;
+#endif
+    return intersectaEscalar;
+}
+
+NucleoSimd mejorNucleo() {
+    if (soportado(NucleoSimd::AVX2)) return NucleoSimd::AVX2;
+    if (soportado(NucleoSimd::SSE41)) return NucleoSimd::SSE41;
+    return NucleoSimd::ESCALAR;
+}
+
+NucleoSimd nucleo_activo = mejorNucleo();
+FuncionInterseca interseca = funcionDe(nucleo_activo);
+
+// ¿Algún vecino v < u de u está activo en w? Con las palabras de w
+// anteriores a la de u ya reparadas y los bits menores de su palabra también.
+inline bool hayVecinoMenorDenso(const uint64_t* w, int u, const Grafo& grafo) {
+    const uint64_t* fila = grafo.filaBits(u);
+    size_t p = static_cast<size_t>(u) >> 6;
+    uint64_t menores = (1ULL << (u & 63)) - 1;
+    return (fila[p] & w[p] & menores) || interseca(fila, w, p);
+}
+
+// Cruce uniforme; al_cambiar(p) recibe cada palabra en la que los hijos
+// difieren de sus padres
+template <typename AlCambiar>
+inline void cruzarCon(const uint64_t* p1, const uint64_t* p2, uint64_t* h1, uint64_t* h2,
+                      size_t num_palabras, double p_cruce, Rng& gen, AlCambiar&& al_cambiar) {
+    if (gen.uniforme() > p_cruce) {
+        std::memcpy(h1, p1, num_palabras * sizeof(uint64_t));
+        std::memcpy(h2, p2, num_palabras * sizeof(uint64_t));
+        return;
+    }
+
+    // Cada bit de la máscara decide de qué padre hereda cada hijo; las
+    // máscaras se generan de una vez en h1, que se sobrescribe palabra a palabra
+    gen.llenar(h1, num_palabras);
+    for (size_t p = 0; p < num_palabras; ++p) {
+        uint64_t m = h1[p];
+        h1[p] = (p1[p] & m) | (p2[p] & ~m);
+        h2[p] = (p2[p] & m) | (p1[p] & ~m);
+        if ((p1[p] ^ p2[p]) & ~m) al_cambiar(p);
+    }
+}
+
+// Mutación bit-flip; al_invertir(p, antes, despues) recibe la palabra de
+// cada gen invertido
+template <typename AlInvertir>
+inline void mutarCon(uint64_t* w, size_t n, double p_mut, Rng& gen, AlInvertir&& al_invertir) {
+    if (n == 0 || p_mut <= 0.0) return;
+
+    if (p_mut >= 1.0) {
+        size_t num_palabras = (n + 63) / 64;
+        for (size_t p = 0; p < num_palabras; ++p) {
+            uint64_t antes = w[p];
+            w[p] = ~w[p];
+            if (p + 1 == num_palabras && (n & 63)) w[p] &= (1ULL << (n & 63)) - 1;
+            al_invertir(p, antes, w[p]);
+        }
+        return;
+    }
+
+    // Salto geométrico: cantidad de genes sin mutar antes del próximo flip,
+    // floor(log(U) / log(1 - p)) con U uniforme en (0, 1]
+    const double inv_log_q = 1.0 / std::log1p(-p_mut);
+    size_t pos = 0;
+    while (true) {
+        double u = 1.0 - gen.uniforme();
+        double salto = std::floor(std::log(u) * inv_log_q);
+        if (salto >= static_cast<double>(n - pos)) break;
+        pos += static_cast<size_t>(salto);
+        uint64_t antes = w[pos >> 6];
+        w[pos >> 6] ^= 1ULL << (pos & 63);
+        al_invertir(pos >> 6, antes, w[pos >> 6]);
+        if (++pos >= n) break;
+    }
+}
+
+} // namespace
+
+NucleoSimd Operadores::nucleoSimd() {
+    return nucleo_activo;
+}
+
+bool Operadores::fijarNucleoSimd(NucleoSimd nucleo) {
+    if (!soportado(nucleo)) return false;
+    nucleo_activo = nucleo;
+    interseca = funcionDe(nucleo);
+    return true;
+}
+
+const char* Operadores::nombreNucleo(NucleoSimd nucleo) {
+    switch (nucleo) {
+        case NucleoSimd::ESCALAR: return "escalar";
+        case NucleoSimd::SSE41: return "sse4.1";
+        case NucleoSimd::AVX2: return "avx2";
+    }
+    return "?";
+}
+
+int Operadores::reparar(
+    uint64_t* w,
+    size_t num_palabras,
+    const Grafo& grafo
 ) {
-    int n = ind.cromosoma.size();
-    int fitness_calculado = 0;
-    
-    for (int u = 0; u < n; ++u) {
-        if (ind.cromosoma[u] == false) {
-            continue;
+    int fitness = 0;
+
+    if (grafo.tieneMatrizBits()) {
+        // Camino denso: fila de u AND prefijo ya reparado
+        for (size_t p = 0; p < num_palabras; ++p) {
+            uint64_t activos = w[p];
+            while (activos) {
+                int bit = __builtin_ctzll(activos);
+                activos &= activos - 1;
+                int u = static_cast<int>(p * 64 + bit);
+                if (hayVecinoMenorDenso(w, u, grafo)) {
+                    w[p] &= ~(1ULL << bit);
+                }
+            }
+            fitness += __builtin_popcountll(w[p]);
         }
+        return fitness;
+    }
+
+    // Recorre solo los genes activos; un nodo se descarta si algún vecino
+    // de menor índice sigue en la solución (ya reparado).
+    for (size_t p = 0; p < num_palabras; ++p) {
+        uint64_t activos = w[p];
+        while (activos) {
+            int bit = __builtin_ctzll(activos);
+            activos &= activos - 1;
+            int u = static_cast<int>(p * 64 + bit);
 
-        bool es_valido = true;
-        for (int v : adj_set[u]) {
-            if (v < u && ind.cromosoma[v] == true) {
-                es_valido = false;
-                break;
+            // Vecinos ordenados: basta revisar el prefijo v < u
+            for (int v : grafo.vecinosDe(u)) {
+                if (v >= u) break;
+                if ((w[v >> 6] >> (v & 63)) & 1ULL) {
+                    w[p] &= ~(1ULL << bit);
+                    break;
+                }
             }
         }
+        fitness += __builtin_popcountll(w[p]);
+    }
+
+    return fitness;
+}
+
+int Operadores::repararIncremental(
+    uint64_t* w,
+    const uint64_t* referencia,
+    int fitness_referencia,
+    size_t num_palabras,
+    const Grafo& grafo,
+    uint64_t* pendientes
+) {
+    int delta = 0;
+
+    for (size_t p = 0; p < num_palabras; ++p) {
+        // Pendientes de la palabra: genes distintos de la referencia más los
+        // marcados por vecinos menores que cambiaron de estado
+        pendientes[p] |= w[p] ^ referencia[p];
+        while (pendientes[p]) {
+            int bit = __builtin_ctzll(pendientes[p]);
+            pendientes[p] &= pendientes[p] - 1;
+            int u = static_cast<int>(p * 64 + bit);
+            uint64_t b = 1ULL << bit;
+
+            bool antes = (referencia[p] & b) != 0;
+            bool ahora = (w[p] & b) != 0;
 
-        if (es_valido) {
-            ind.cromosoma[u] = true;
-            fitness_calculado++;
-        } else {
-            ind.cromosoma[u] = false;
+            if (grafo.tieneMatrizBits()) {
+                if (ahora && hayVecinoMenorDenso(w, u, grafo)) {
+                    ahora = false;
+                    w[p] &= ~b;
+                }
+                if (ahora == antes) continue;
+                delta += ahora ? 1 : -1;
+                if (!ahora) continue;
+                // Vecinos mayores activos: fila AND w desde la palabra de u
+                const uint64_t* fila = grafo.filaBits(u);
+                uint64_t mayores = ~((b << 1) - 1);
+                pendientes[p] |= fila[p] & w[p] & mayores;
+                for (size_t q = p + 1; q < num_palabras; ++q) {
+                    pendientes[q] |= fila[q] & w[q];
+                }
+                continue;
+            }
+
+            Grafo::Vecinos lista = grafo.vecinosDe(u);
+            const int* mayores = lista.end();
+            if (ahora) {
+                for (const int* it = lista.begin(); it != lista.end(); ++it) {
+                    int v = *it;
+                    if (v > u) {
+                        mayores = it;
+                        break;
+                    }
+                    if ((w[v >> 6] >> (v & 63)) & 1ULL) {
+                        ahora = false;
+                        w[p] &= ~b;
+                        break;
+                    }
+                }
+            }
+            if (ahora == antes) continue;
+
+            delta += ahora ? 1 : -1;
+
+            // Si u sale, sus vecinos activos no estaban en la referencia
+            // (era independiente) y ya son pendientes por sí mismos
+            if (!ahora) continue;
+            if (mayores == lista.end()) {
+                mayores = std::upper_bound(lista.begin(), lista.end(), u);
+            }
+            for (const int* it = mayores; it != lista.end(); ++it) {
+                int x = *it;
+                uint64_t bx = 1ULL << (x & 63);
+                if (w[x >> 6] & bx) pendientes[x >> 6] |= bx;
+            }
         }
     }
-    
-    ind.fitness = fitness_calculado;
+
+    return fitness_referencia + delta;
+}
+
+int Operadores::repararDesdePadres(
+    uint64_t* w,
+    const uint64_t* padre1,
+    int fitness1,
+    const uint64_t* padre2,
+    int fitness2,
+    size_t num_palabras,
+    const Grafo& grafo,
+    uint64_t* pendientes
+) {
+    int activos = 0, distancia1 = 0, distancia2 = 0;
+    for (size_t p = 0; p < num_palabras; ++p) {
+        activos += __builtin_popcountll(w[p]);
+        distancia1 += __builtin_popcountll(w[p] ^ padre1[p]);
+        distancia2 += __builtin_popcountll(w[p] ^ padre2[p]);
+    }
+
+    bool usar1 = (distancia1 <= distancia2);
+    int distancia = usar1 ? distancia1 : distancia2;
+    if (2 * distancia > activos) {
+        return reparar(w, num_palabras, grafo);
+    }
+    return usar1
+        ? repararIncremental(w, padre1, fitness1, num_palabras, grafo, pendientes)
+        : repararIncremental(w, padre2, fitness2, num_palabras, grafo, pendientes);
+}
+
+int Operadores::seleccionarPorTorneo(
+    const std::vector<int>& fitness,
+    Rng& gen
+) {
+    int idx[2];
+    gen.indices(idx, 2, static_cast<uint32_t>(fitness.size()));
+    return mejorDelTorneo(fitness.data(), idx);
+}
+
+void Operadores::cruzar(
+    const uint64_t* p1,
+    const uint64_t* p2,
+    uint64_t* h1,
+    uint64_t* h2,
+    size_t num_palabras,
+    double p_cruce,
+    Rng& gen
+) {
+    cruzarCon(p1, p2, h1, h2, num_palabras, p_cruce, gen, [](size_t) {});
+}
+
+void Operadores::cruzar(
+    const uint64_t* p1,
+    const uint64_t* p2,
+    uint64_t* h1,
+    uint64_t* h2,
+    size_t num_palabras,
+    double p_cruce,
+    Rng& gen,
+    uint64_t& hash1,
+    uint64_t& hash2
+) {
+    // h1 = p1 ^ ((p1 ^ p2) & ~m) y h2 = p2 ^ ((p1 ^ p2) & ~m): ambos hijos
+    // cambian respecto de su padre en las mismas palabras
+    cruzarCon(p1, p2, h1, h2, num_palabras, p_cruce, gen, [&](size_t p) {
+        hash1 ^= Zobrist::cambio(p, p1[p], h1[p]);
+        hash2 ^= Zobrist::cambio(p, p2[p], h2[p]);
+    });
+}
+
+void Operadores::mutar(
+    uint64_t* w,
+    size_t n,
+    double p_mut,
+    Rng& gen
+) {
+    mutarCon(w, n, p_mut, gen, [](size_t, uint64_t, uint64_t) {});
+}
+
+void Operadores::mutar(uint64_t* w, size_t n, double p_mut, Rng& gen, uint64_t& hash) {
+    mutarCon(w, n, p_mut, gen, [&](size_t p, uint64_t antes, uint64_t despues) {
+        hash ^= Zobrist::cambio(p, antes, despues);
+    });
+}
+
+void Operadores::reparar_y_evaluar(
+    Individuo& ind,
+    const Grafo& grafo
+) {
+    ind.fitness = reparar(ind.cromosoma.datos(), ind.cromosoma.numPalabras(), grafo);
 }
 
 Individuo Operadores::seleccionPorTorneo(
     const std::vector<Individuo>& poblacion,
-    std::mt19937& gen
+    Rng& gen
 ) {
-    std::uniform_int_distribution<> dis_idx(0, poblacion.size() - 1);
-    
-    int idx1 = dis_idx(gen);
-    int idx2 = dis_idx(gen);
+    int idx1 = static_cast<int>(gen.acotado(static_cast<uint32_t>(poblacion.size())));
+    int idx2 = static_cast<int>(gen.acotado(static_cast<uint32_t>(poblacion.size())));
 
     if (poblacion[idx1].fitness > poblacion[idx2].fitness) {
         return poblacion[idx1];
@@ -51,43 +413,22 @@ std::pair<Individuo, Individuo> Operadores::cruceUniforme(
     const Individuo& padre1,
     const Individuo& padre2,
     double p_cruce,
-    std::mt19937& gen
+    Rng& gen
 ) {
-    std::uniform_real_distribution<> dis_prob(0.0, 1.0);
-
-    if (dis_prob(gen) > p_cruce) {
-        return {padre1, padre2};
-    }
-
     int n = padre1.cromosoma.size();
-    Individuo hijo1(n);
-    Individuo hijo2(n);
-
-    for (int i = 0; i < n; ++i) {
-        if (dis_prob(gen) < 0.5) {
-            hijo1.cromosoma[i] = padre1.cromosoma[i];
-            hijo2.cromosoma[i] = padre2.cromosoma[i];
-        } else {
-            hijo1.cromosoma[i] = padre2.cromosoma[i];
-            hijo2.cromosoma[i] = padre1.cromosoma[i];
-        }
-    }
-
-    return {hijo1, hijo2};
+    std::pair<Individuo, Individuo> hijos{Individuo(n), Individuo(n)};
+    cruzar(padre1.cromosoma.datos(), padre2.cromosoma.datos(),
+           hijos.first.cromosoma.datos(), hijos.second.cromosoma.datos(),
+           padre1.cromosoma.numPalabras(), p_cruce, gen);
+    return hijos;
 }
 
 void Operadores::mutacionBitFlip(
     Individuo& ind,
     double p_mut,
-    std::mt19937& gen
+    Rng& gen
 ) {
-    std::uniform_real_distribution<> dis_prob(0.0, 1.0);
-    
-    for (size_t i = 0; i < ind.cromosoma.size(); ++i) {
-        if (dis_prob(gen) < p_mut) {
-            ind.cromosoma[i] = !ind.cromosoma[i];
-        }
-    }
+    mutar(ind.cromosoma.datos(), ind.cromosoma.size(), p_mut, gen);
 }
 
 Individuo Operadores::obtenerMejor(const std::vector<Individuo>& poblacion) {
@@ -2,25 +2,171 @@
 #define OPERADORES_H
 
 #include <vector>
+#include <cstdint>
 #include <utility>
-#include <random>
-#include <unordered_set>
+#include "Grafo.h"
 #include "Individuo.h"
+#include "Rng.h"
+
+/**
+ * @brief Implementación del test de intersección de bitsets de la reparación
+ */
+enum class NucleoSimd {
+    ESCALAR,
+    SSE41,
+    AVX2
+};
 
 /**
  * @brief Clase con operadores genéticos del algoritmo
  */
 class Operadores {
 public:
+    // --- Núcleos sobre palabras de 64 bits (sin asignaciones) ---
+    // Trabajan sobre cromosomas empaquetados (Cromosoma o filas de una
+    // Poblacion); los bits sobrantes de la última palabra deben ser cero.
+
+    /**
+     * @brief Repara un cromosoma empaquetado y retorna su fitness
+     *
+     * Si el grafo tiene matriz de bits (grafos densos), el conflicto de u
+     * se detecta con AND entre su fila y el prefijo ya reparado de w,
+     * palabra a palabra con SIMD; si no, se recorren sus vecinos en el CSR.
+     * @param w Palabras del cromosoma (modificadas in-place)
+     * @param num_palabras Cantidad de palabras
+     * @param grafo Grafo en formato CSR
+     * @return Tamaño del conjunto independiente resultante
+     */
+    static int reparar(uint64_t* w, size_t num_palabras, const Grafo& grafo);
+
+    /**
+     * @brief Repara un cromosoma revisando solo los genes que difieren de
+     *        un padre válido (evaluación delta)
+     *
+     * La reparación conserva u si ningún vecino v < u quedó en la solución,
+     * así que un gen igual al de la referencia solo puede cambiar si cambió
+     * algún vecino menor. Se procesan en orden ascendente los genes
+     * distintos de la referencia y, cuando uno cambia de estado, sus vecinos
+     * mayores activos. El resultado es idéntico bit a bit a reparar().
+     * @param w Palabras del cromosoma (modificadas in-place)
+     * @param referencia Conjunto independiente del que deriva w
+     * @param fitness_referencia Cantidad de genes activos de la referencia
+     * @param num_palabras Cantidad de palabras
+     * @param grafo Grafo en formato CSR
+     * @param pendientes Buffer de num_palabras palabras en cero (queda en cero)
+     * @return Tamaño del conjunto independiente resultante
+     */
+    static int repararIncremental(
+        uint64_t* w,
+        const uint64_t* referencia,
+        int fitness_referencia,
+        size_t num_palabras,
+        const Grafo& grafo,
+        uint64_t* pendientes
+    );
+
+    /**
+     * @brief Repara un hijo tomando como referencia el padre más parecido
+     *
+     * Usa repararIncremental() con el padre a menor distancia de Hamming;
+     * si el hijo difiere en más de la mitad de sus genes activos, la
+     * reparación completa es más barata y se usa reparar().
+     * @return Tamaño del conjunto independiente resultante
+     */
+    static int repararDesdePadres(
+        uint64_t* w,
+        const uint64_t* padre1,
+        int fitness1,
+        const uint64_t* padre2,
+        int fitness2,
+        size_t num_palabras,
+        const Grafo& grafo,
+        uint64_t* pendientes
+    );
+
+    /**
+     * @brief Torneo binario sobre un arreglo de fitness
+     * @return Índice del ganador
+     */
+    static int seleccionarPorTorneo(const std::vector<int>& fitness, Rng& gen);
+
+    /**
+     * @brief Torneo binario entre dos candidatos ya sorteados (p. ej. con Rng::indices)
+     * @return El de mayor fitness; con empate, el segundo
+     */
+    static int mejorDelTorneo(const int* fitness, const int candidatos[2]) {
+        return fitness[candidatos[0]] > fitness[candidatos[1]] ? candidatos[0] : candidatos[1];
+    }
+
+    /**
+     * @brief Cruce uniforme escribiendo los hijos en buffers existentes
+     *
+     * Con probabilidad 1 - p_cruce los hijos son copias de los padres; si
+     * no, con una máscara aleatoria m por palabra,
+     * h1 = (p1 & m) | (p2 & ~m) y h2 = (p2 & m) | (p1 & ~m).
+     */
+    static void cruzar(
+        const uint64_t* p1,
+        const uint64_t* p2,
+        uint64_t* h1,
+        uint64_t* h2,
+        size_t num_palabras,
+        double p_cruce,
+        Rng& gen
+    );
+
+    /**
+     * @brief cruzar() manteniendo el hash Zobrist (ver Zobrist.h)
+     *
+     * Consume los mismos números aleatorios y produce los mismos hijos.
+     * @param hash1 Entra con H(p1) y sale con H(h1)
+     * @param hash2 Entra con H(p2) y sale con H(h2)
+     */
+    static void cruzar(
+        const uint64_t* p1,
+        const uint64_t* p2,
+        uint64_t* h1,
+        uint64_t* h2,
+        size_t num_palabras,
+        double p_cruce,
+        Rng& gen,
+        uint64_t& hash1,
+        uint64_t& hash2
+    );
+
+    /**
+     * @brief Mutación bit-flip por saltos geométricos sobre n genes
+     */
+    static void mutar(uint64_t* w, size_t n, double p_mut, Rng& gen);
+
+    /**
+     * @brief mutar() actualizando 'hash' en O(1) por gen invertido
+     */
+    static void mutar(uint64_t* w, size_t n, double p_mut, Rng& gen, uint64_t& hash);
+
+    /**
+     * @brief Núcleo SIMD en uso (elegido al iniciar según la CPU)
+     */
+    static NucleoSimd nucleoSimd();
+
+    /**
+     * @brief Fuerza un núcleo SIMD; false si la CPU no lo soporta
+     */
+    static bool fijarNucleoSimd(NucleoSimd nucleo);
+
+    static const char* nombreNucleo(NucleoSimd nucleo);
+
+    // --- Interfaz sobre Individuo ---
+
     /**
      * @brief Repara un individuo para que sea un conjunto independiente válido
      *        y calcula su fitness
      * @param ind Individuo a reparar (modificado in-place)
-     * @param adj_set Set de adyacencia del grafo
+     * @param grafo Grafo en formato CSR
      */
     static void reparar_y_evaluar(
         Individuo& ind,
-        const std::vector<std::vector<int>>& adj_set
+        const Grafo& grafo
     );
 
     /**
@@ -31,11 +177,11 @@ public:
      */
     static Individuo seleccionPorTorneo(
         const std::vector<Individuo>& poblacion,
-        std::mt19937& gen
+        Rng& gen
     );
 
     /**
-     * @brief Aplica cruce uniforme entre dos padres
+     * @brief Aplica cruce uniforme entre dos padres (ver cruzar)
      * @param padre1 Primer padre
      * @param padre2 Segundo padre
      * @param p_cruce Probabilidad de aplicar cruce
@@ -46,11 +192,16 @@ public:
         const Individuo& padre1,
         const Individuo& padre2,
         double p_cruce,
-        std::mt19937& gen
+        Rng& gen
     );
 
     /**
      * @brief Aplica mutación bit-flip a un individuo
+     *
+     * En vez de sortear cada gen, muestrea la distancia hasta el siguiente
+     * gen mutado con una distribución geométrica de parámetro p_mut. Es
+     * equivalente a n sorteos Bernoulli independientes, pero el costo es
+     * proporcional a la cantidad de flips (~n·p_mut) y no a n.
      * @param ind Individuo a mutar (modificado in-place)
      * @param p_mut Probabilidad de mutar cada bit
      * @param gen Generador de números aleatorios
@@ -58,7 +209,7 @@ public:
     static void mutacionBitFlip(
         Individuo& ind,
         double p_mut,
-        std::mt19937& gen
+        Rng& gen
     );
 
     /**
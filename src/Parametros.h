@@ -0,0 +1,105 @@
+#ifndef PARAMETROS_H
+#define PARAMETROS_H
+
+#include <string>
+#include "Rng.h"
+
+/**
+ * @brief Topología de migración del modelo de islas
+ */
+enum class TopologiaIslas {
+    ANILLO,     // la isla i envía a la isla (i + 1) % K
+    COMPLETA    // cada isla envía a todas las demás
+};
+
+/**
+ * @brief Numeración de los vértices con la que corre el GA
+ *
+ * La reparación conserva el vértice de menor índice en cada conflicto,
+ * así que la numeración es también la prioridad de la reparación.
+ */
+enum class OrdenVertices {
+    ORIGINAL,   // ids del archivo
+    GRADO,      // grado ascendente: la reparación prefiere vértices de grado bajo
+    RCM,        // Cuthill-McKee inverso: vecinos con ids cercanos (localidad)
+    ALEATORIO   // permutación al azar (derivada de la semilla)
+};
+
+/**
+ * @brief Modelo de reemplazo de la población
+ */
+enum class ModeloGA {
+    GENERACIONAL,  // cada generación reemplaza la población entera
+    ESTACIONARIO   // cada hijo reemplaza en el lugar al peor si no es peor que él
+};
+
+/**
+ * @brief Parámetros del algoritmo genético
+ */
+struct ParametrosGA {
+    std::string instancia;
+    double max_time;
+    long long max_generaciones;  // -1 = sin límite; si no, corta al llegar (o antes, por tiempo)
+    int pop_size;
+    double p_cruce;
+    double p_mut;
+    int k_greedy;
+    double seeding_rate;
+    int seed;  // -1 = aleatorio, >= 0 = fija
+    Rng::Tipo rng;  // Motor de números aleatorios
+    bool usar_cache;  // Leer/escribir el cache binario '<instancia>.csr'
+    int num_hilos;  // Hilos para generar la descendencia
+    int num_islas;  // 1 = población única; K > 1 = modelo de islas
+    int intervalo_migracion;  // Generaciones entre migraciones
+    int num_migrantes;  // Mejores individuos enviados en cada migración
+    TopologiaIslas topologia;
+    ModeloGA modelo;
+    bool busqueda_local;  // Aplicar búsqueda local ARW a la descendencia
+    double presupuesto_bl;  // Vecinos visitables por generación, en múltiplos de n + 2m
+    bool stats_json;  // Emitir telemetría como un registro JSON al terminar
+    bool reducir;     // Kernelizar el grafo antes del GA
+    bool componentes; // Resolver cada componente conexa por separado
+    OrdenVertices orden;  // Renumeración de vértices antes del GA
+    int cache_evaluaciones;  // Entradas de la cache de reparaciones por motor (0 = sin cache)
+    double reinicio_diversidad;     // Reiniciar si la distancia muestreada cae debajo (0 = nunca)
+    double reinicio_estancamiento;  // Reiniciar tras estos segundos sin mejora (0 = nunca)
+    int reinicio_elite;             // Mejores individuos que sobreviven a un reinicio
+    std::string checkpoint;  // Archivo de checkpoint ("" = sin checkpoints)
+    double checkpoint_cada;  // Segundos entre checkpoints
+    std::string reanudar;    // Checkpoint desde el cual continuar ("" = corrida nueva)
+
+    // Valores por defecto
+    ParametrosGA() 
+        : instancia(""),
+          max_time(10.0),
+          max_generaciones(-1),
+          pop_size(100),
+          p_cruce(0.9),
+          p_mut(0.01),
+          k_greedy(10),
+          seeding_rate(0.2),
+          seed(-1),
+          rng(Rng::Tipo::MT19937_64),
+          usar_cache(true),
+          num_hilos(1),
+          num_islas(1),
+          intervalo_migracion(10),
+          num_migrantes(1),
+          topologia(TopologiaIslas::ANILLO),
+          modelo(ModeloGA::GENERACIONAL),
+          busqueda_local(false),
+          presupuesto_bl(4.0),
+          stats_json(false),
+          reducir(false),
+          componentes(false),
+          orden(OrdenVertices::ORIGINAL),
+          cache_evaluaciones(0),
+          reinicio_diversidad(0.0),
+          reinicio_estancamiento(0.0),
+          reinicio_elite(1),
+          checkpoint(""),
+          checkpoint_cada(60.0),
+          reanudar("") {}
+};
+
+#endif // PARAMETROS_H
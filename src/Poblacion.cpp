@@ -0,0 +1,45 @@
+#include "Poblacion.h"
+#include <algorithm>
+#include <cstring>
+
+Poblacion::Poblacion(int tam, int n)
+    : n(n),
+      num_palabras((static_cast<size_t>(n) + 63) / 64),
+      stride((num_palabras + 7) / 8 * 8),
+      arena(static_cast<size_t>(tam) * stride, 0),
+      aptitudes(tam, 0),
+      hashes(tam, 0) {}
+
+int Poblacion::indiceMejor() const {
+    return static_cast<int>(std::max_element(aptitudes.begin(), aptitudes.end()) - aptitudes.begin());
+}
+
+int Poblacion::indicePeor() const {
+    return static_cast<int>(std::min_element(aptitudes.begin(), aptitudes.end()) - aptitudes.begin());
+}
+
+void Poblacion::copiarDesde(int destino, const Poblacion& origen, int i) {
+    std::memcpy(cromosoma(destino), origen.cromosoma(i), num_palabras * sizeof(uint64_t));
+    aptitudes[destino] = origen.aptitudes[i];
+    hashes[destino] = origen.hashes[i];
+}
+
+void Poblacion::cargar(int i, const Individuo& ind) {
+    std::memcpy(cromosoma(i), ind.cromosoma.datos(), num_palabras * sizeof(uint64_t));
+    aptitudes[i] = ind.fitness;
+    hashes[i] = 0;
+}
+
+void Poblacion::exportar(int i, Individuo& ind) const {
+    std::memcpy(ind.cromosoma.datos(), cromosoma(i), num_palabras * sizeof(uint64_t));
+    ind.fitness = aptitudes[i];
+}
+
+void Poblacion::swap(Poblacion& otra) {
+    std::swap(n, otra.n);
+    std::swap(num_palabras, otra.num_palabras);
+    std::swap(stride, otra.stride);
+    arena.swap(otra.arena);
+    aptitudes.swap(otra.aptitudes);
+    hashes.swap(otra.hashes);
+}
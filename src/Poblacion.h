@@ -0,0 +1,82 @@
+#ifndef POBLACION_H
+#define POBLACION_H
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include "Individuo.h"
+
+/**
+ * @brief Población almacenada en una arena contigua de cromosomas
+ *
+ * Los cromosomas empaquetados de todos los individuos viven en un único
+ * arreglo de palabras; la fila i empieza en i * stride. El stride se
+ * redondea a múltiplos de 8 palabras (64 bytes) para que dos hilos que
+ * escriben filas vecinas no compartan línea de cache. Toda la memoria se
+ * reserva en el constructor: el bucle generacional solo escribe filas.
+ */
+class Poblacion {
+public:
+    Poblacion(int tam, int n);
+
+    int tamano() const { return static_cast<int>(aptitudes.size()); }
+    int numNodos() const { return n; }
+
+    /**
+     * @brief Palabras significativas de cada cromosoma (ceil(n / 64))
+     */
+    size_t numPalabras() const { return num_palabras; }
+
+    uint64_t* cromosoma(int i) { return arena.data() + static_cast<size_t>(i) * stride; }
+    const uint64_t* cromosoma(int i) const { return arena.data() + static_cast<size_t>(i) * stride; }
+
+    int& fitness(int i) { return aptitudes[i]; }
+    int fitness(int i) const { return aptitudes[i]; }
+    const std::vector<int>& fitnesses() const { return aptitudes; }
+
+    /**
+     * @brief Hash Zobrist de la fila i (lo mantiene MotorGA con --eval_cache)
+     *
+     * copiarDesde() y swap() lo llevan junto con la fila; cargar() lo deja
+     * en cero.
+     */
+    uint64_t& hash(int i) { return hashes[i]; }
+    uint64_t hash(int i) const { return hashes[i]; }
+
+    /**
+     * @brief Índice del individuo de mayor fitness (el primero si hay empate)
+     */
+    int indiceMejor() const;
+
+    /**
+     * @brief Índice del individuo de menor fitness
+     */
+    int indicePeor() const;
+
+    /**
+     * @brief Copia el individuo i de 'origen' en la fila 'destino'
+     */
+    void copiarDesde(int destino, const Poblacion& origen, int i);
+
+    /**
+     * @brief Escribe un Individuo (mismo n) en la fila i
+     */
+    void cargar(int i, const Individuo& ind);
+
+    /**
+     * @brief Copia la fila i en un Individuo ya dimensionado (sin asignar memoria)
+     */
+    void exportar(int i, Individuo& ind) const;
+
+    void swap(Poblacion& otra);
+
+private:
+    int n;
+    size_t num_palabras;
+    size_t stride;
+    std::vector<uint64_t> arena;
+    std::vector<int> aptitudes;
+    std::vector<uint64_t> hashes;
+};
+
+#endif // POBLACION_H
@@ -0,0 +1,59 @@
+#include "PoolHilos.h"
+
+PoolHilos::PoolHilos(int num_hilos)
+    : tarea_actual(nullptr), ronda(0), pendientes(0), terminar(false) {
+    for (int id = 1; id < num_hilos; ++id) {
+        trabajadores.emplace_back(&PoolHilos::bucleTrabajador, this, id);
+    }
+}
+
+PoolHilos::~PoolHilos() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        terminar = true;
+    }
+    cv_inicio.notify_all();
+    for (std::thread& t : trabajadores) t.join();
+}
+
+void PoolHilos::ejecutar(const std::function<void(int)>& tarea) {
+    if (trabajadores.empty()) {
+        tarea(0);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        tarea_actual = &tarea;
+        pendientes = static_cast<int>(trabajadores.size());
+        ++ronda;
+    }
+    cv_inicio.notify_all();
+
+    tarea(0);
+
+    std::unique_lock<std::mutex> lock(mutex);
+    cv_fin.wait(lock, [this] { return pendientes == 0; });
+    tarea_actual = nullptr;
+}
+
+void PoolHilos::bucleTrabajador(int id) {
+    unsigned long long ronda_vista = 0;
+    while (true) {
+        const std::function<void(int)>* tarea;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            cv_inicio.wait(lock, [&] { return terminar || ronda != ronda_vista; });
+            if (terminar) return;
+            ronda_vista = ronda;
+            tarea = tarea_actual;
+        }
+
+        (*tarea)(id);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (--pendientes == 0) cv_fin.notify_one();
+        }
+    }
+}
@@ -0,0 +1,54 @@
+#ifndef POOL_HILOS_H
+#define POOL_HILOS_H
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Pool fijo de hilos para regiones paralelas
+ *
+ * ejecutar(tarea) corre tarea(id) en los N hilos a la vez (id = 0..N-1) y
+ * retorna cuando todos terminaron. El hilo que llama actúa como hilo 0, así
+ * que un pool de tamaño 1 no crea hilos y no agrega sincronización.
+ */
+class PoolHilos {
+public:
+    explicit PoolHilos(int num_hilos);
+    ~PoolHilos();
+
+    PoolHilos(const PoolHilos&) = delete;
+    PoolHilos& operator=(const PoolHilos&) = delete;
+
+    int tamano() const { return static_cast<int>(trabajadores.size()) + 1; }
+
+    /**
+     * @brief Ejecuta la tarea en todos los hilos y espera a que terminen
+     * @param tarea Función que recibe el id del hilo
+     */
+    void ejecutar(const std::function<void(int)>& tarea);
+
+    /**
+     * @brief Reparte [0, total) en bloques contiguos y balanceados por hilo
+     */
+    static void rango(int total, int id, int num_hilos, int& inicio, int& fin) {
+        inicio = static_cast<int>(static_cast<long long>(total) * id / num_hilos);
+        fin = static_cast<int>(static_cast<long long>(total) * (id + 1) / num_hilos);
+    }
+
+private:
+    void bucleTrabajador(int id);
+
+    std::vector<std::thread> trabajadores;
+    std::mutex mutex;
+    std::condition_variable cv_inicio;
+    std::condition_variable cv_fin;
+    const std::function<void(int)>* tarea_actual;
+    unsigned long long ronda;
+    int pendientes;
+    bool terminar;
+};
+
+#endif // POOL_HILOS_H
@@ -0,0 +1,310 @@
+#include "Reduccion.h"
+#include <algorithm>
+#include <climits>
+#include <utility>
+
+// Grafo mutable con listas de adyacencia. Los vértices quitados solo se
+// marcan muertos; cada lista se compacta cuando se recorre entera, así los
+// vecinos muertos se borran una sola vez.
+struct Reduccion::GrafoTrabajo {
+    std::vector<std::vector<int>> ady;
+    std::vector<int> grado;               // vecinos vivos
+    std::vector<char> vivo;
+    std::vector<char> en_cola;
+    std::vector<int> cola;                // pila de vértices por revisar
+    std::vector<int> marca;
+    int sello = 0;
+    std::vector<int> grado_dominacion;    // grado en la última revisión de dominación (-1 = nunca)
+    std::vector<int> union_vecinos;
+    std::vector<int> vecinos_incluido;
+
+    std::vector<Operacion>& operaciones;
+    int& offset;
+    Estadisticas& stats;
+
+    GrafoTrabajo(const Grafo& grafo, std::vector<Operacion>& operaciones, int& offset, Estadisticas& stats)
+        : ady(grafo.n), grado(grafo.n), vivo(grafo.n, 1), en_cola(grafo.n, 0),
+          marca(grafo.n, 0), grado_dominacion(grafo.n, -1),
+          operaciones(operaciones), offset(offset), stats(stats) {
+        for (int u = 0; u < grafo.n; ++u) {
+            Grafo::Vecinos vecinos = grafo.vecinosDe(u);
+            ady[u].assign(vecinos.begin(), vecinos.end());
+            grado[u] = static_cast<int>(vecinos.size());
+        }
+    }
+
+    int numIds() const { return static_cast<int>(ady.size()); }
+
+    int nuevoVertice() {
+        ady.emplace_back();
+        grado.push_back(0);
+        vivo.push_back(1);
+        en_cola.push_back(0);
+        marca.push_back(0);
+        grado_dominacion.push_back(-1);
+        return numIds() - 1;
+    }
+
+    int nuevoSello() {
+        if (++sello == INT_MAX) {
+            std::fill(marca.begin(), marca.end(), 0);
+            sello = 1;
+        }
+        return sello;
+    }
+
+    void encolar(int v) {
+        if (!en_cola[v]) {
+            en_cola[v] = 1;
+            cola.push_back(v);
+        }
+    }
+
+    // Lista de v con solo vecinos vivos
+    const std::vector<int>& compactar(int v) {
+        std::vector<int>& lista = ady[v];
+        size_t k = 0;
+        for (int x : lista) {
+            if (vivo[x]) lista[k++] = x;
+        }
+        lista.resize(k);
+        return lista;
+    }
+
+    bool adyacentes(int a, int b) const {
+        if (ady[a].size() > ady[b].size()) std::swap(a, b);
+        for (int x : ady[a]) {
+            if (x == b) return vivo[b];
+        }
+        return false;
+    }
+
+    void quitar(int v) {
+        vivo[v] = 0;
+        for (int x : ady[v]) {
+            if (vivo[x]) {
+                grado[x]--;
+                encolar(x);
+            }
+        }
+        std::vector<int>().swap(ady[v]);
+        grado[v] = 0;
+    }
+
+    void incluir(int v) {
+        operaciones.push_back({TipoOperacion::INCLUIR, {v, -1, -1, -1, -1, -1}});
+        offset++;
+        stats.incluidos++;
+        vecinos_incluido = compactar(v);
+        quitar(v);
+        for (int x : vecinos_incluido) {
+            if (vivo[x]) quitar(x);
+        }
+    }
+
+    // Reemplaza 'plegados' por un vértice nuevo adyacente a la unión de
+    // las vecindades de 'fuentes' (sin los plegados)
+    int plegar(std::initializer_list<int> plegados, std::initializer_list<int> fuentes) {
+        int s = nuevoSello();
+        for (int p : plegados) marca[p] = s;
+        union_vecinos.clear();
+        for (int f : fuentes) {
+            for (int x : compactar(f)) {
+                if (marca[x] != s) {
+                    marca[x] = s;
+                    union_vecinos.push_back(x);
+                }
+            }
+        }
+        for (int p : plegados) quitar(p);
+
+        int nuevo = nuevoVertice();
+        for (int x : union_vecinos) {
+            ady[x].push_back(nuevo);
+            grado[x]++;
+        }
+        ady[nuevo] = union_vecinos;
+        grado[nuevo] = static_cast<int>(union_vecinos.size());
+        encolar(nuevo);
+        return nuevo;
+    }
+
+    // v de grado 3: busca un gemelo t con N(t) = N(v)
+    bool gemelos(int v) {
+        const std::vector<int>& nv = compactar(v);
+        int a = nv[0], b = nv[1], c = nv[2];
+        int p = a;
+        if (grado[b] < grado[p]) p = b;
+        if (grado[c] < grado[p]) p = c;
+        if (grado[p] > LIMITE_PLIEGUE) return false;
+
+        int s = nuevoSello();
+        marca[a] = marca[b] = marca[c] = s;
+        int gemelo = -1;
+        for (int t : compactar(p)) {
+            if (t == v || grado[t] != 3) continue;
+            const std::vector<int>& nt = compactar(t);
+            if (marca[nt[0]] == s && marca[nt[1]] == s && marca[nt[2]] == s) {
+                gemelo = t;
+                break;
+            }
+        }
+        if (gemelo == -1) return false;
+
+        if (adyacentes(a, b) || adyacentes(a, c) || adyacentes(b, c)) {
+            // A lo sumo dos de a, b, c en la solución: v y el gemelo no pierden
+            incluir(v);
+            incluir(gemelo);
+            return true;
+        }
+        if (std::max({grado[a], grado[b], grado[c]}) > LIMITE_PLIEGUE) return false;
+
+        int nuevo = plegar({v, gemelo, a, b, c}, {a, b, c});
+        operaciones.push_back({TipoOperacion::PLIEGUE_GEMELOS, {v, gemelo, a, b, c, nuevo}});
+        offset += 2;
+        stats.pliegues_gemelos++;
+        return true;
+    }
+
+    // Quita v si algún vecino u cumple N[u] ⊆ N[v]. Con grado alto solo se
+    // revisa de nuevo cuando el grado bajó a la mitad desde la última vez.
+    bool dominacion(int v) {
+        int d = grado[v];
+        if (d > LIMITE_DOMINACION && grado_dominacion[v] >= 0 && 2 * d > grado_dominacion[v]) {
+            return false;
+        }
+        grado_dominacion[v] = d;
+
+        int s = nuevoSello();
+        marca[v] = s;
+        for (int x : compactar(v)) marca[x] = s;
+
+        long long trabajo = 0;
+        long long tope = 8LL * d + 64;
+        bool dominado = false;
+        for (int u : ady[v]) {
+            if (grado[u] > d) continue;
+            bool contenido = true;
+            for (int y : ady[u]) {
+                if (!vivo[y]) continue;
+                trabajo++;
+                if (marca[y] != s) {
+                    contenido = false;
+                    break;
+                }
+            }
+            if (contenido) {
+                dominado = true;
+                break;
+            }
+            if (trabajo > tope) break;
+        }
+        if (!dominado) return false;
+
+        stats.dominados++;
+        quitar(v);
+        return true;
+    }
+
+    void procesar(int v) {
+        if (!vivo[v]) return;
+        int d = grado[v];
+        if (d <= 1) {
+            incluir(v);
+            return;
+        }
+        if (d == 2) {
+            const std::vector<int>& nv = compactar(v);
+            int u = nv[0], w = nv[1];
+            if (adyacentes(u, w)) {
+                incluir(v);
+                return;
+            }
+            if (std::max(grado[u], grado[w]) <= LIMITE_PLIEGUE) {
+                int nuevo = plegar({v, u, w}, {u, w});
+                operaciones.push_back({TipoOperacion::PLIEGUE_GRADO2, {v, u, w, nuevo, -1, -1}});
+                offset++;
+                stats.pliegues_grado2++;
+                return;
+            }
+        }
+        if (d == 3 && gemelos(v)) return;
+        dominacion(v);
+    }
+
+    void reducir() {
+        for (int v = numIds() - 1; v >= 0; --v) encolar(v);
+        while (!cola.empty()) {
+            int v = cola.back();
+            cola.pop_back();
+            en_cola[v] = 0;
+            procesar(v);
+        }
+    }
+};
+
+Reduccion::Reduccion(const Grafo& grafo)
+    : n_original(grafo.n), total_ids(grafo.n), offset(0) {
+    stats.nodos_original = grafo.n;
+    stats.aristas_original = grafo.numAristas();
+
+    GrafoTrabajo trabajo(grafo, operaciones, offset, stats);
+    trabajo.reducir();
+    total_ids = trabajo.numIds();
+
+    // Kernel con ids compactos en el orden de los ids de trabajo
+    std::vector<int> id_kernel(total_ids, -1);
+    for (int v = 0; v < total_ids; ++v) {
+        if (trabajo.vivo[v]) {
+            id_kernel[v] = static_cast<int>(id_trabajo.size());
+            id_trabajo.push_back(v);
+        }
+    }
+    std::vector<std::pair<int, int>> aristas;
+    for (int v : id_trabajo) {
+        for (int x : trabajo.compactar(v)) {
+            if (id_kernel[x] > id_kernel[v]) aristas.emplace_back(id_kernel[v], id_kernel[x]);
+        }
+    }
+    nucleo.construirDesdeAristas(static_cast<int>(id_trabajo.size()), aristas);
+
+    stats.nodos_kernel = nucleo.n;
+    stats.aristas_kernel = nucleo.numAristas();
+    stats.desplazamiento = offset;
+}
+
+int Reduccion::reconstruir(const uint64_t* bits_kernel, Cromosoma& original) const {
+    std::vector<char> sol(total_ids, 0);
+    for (int k = 0; k < nucleo.n; ++k) {
+        if ((bits_kernel[k >> 6] >> (k & 63)) & 1ULL) sol[id_trabajo[k]] = 1;
+    }
+
+    // Deshacer en orden inverso: un vértice plegado se resuelve después
+    // de las operaciones que usaron el vértice nuevo
+    for (auto op = operaciones.rbegin(); op != operaciones.rend(); ++op) {
+        const int* v = op->v;
+        switch (op->tipo) {
+            case TipoOperacion::INCLUIR:
+                sol[v[0]] = 1;
+                break;
+            case TipoOperacion::PLIEGUE_GRADO2:
+                if (sol[v[3]]) sol[v[1]] = sol[v[2]] = 1;
+                else sol[v[0]] = 1;
+                break;
+            case TipoOperacion::PLIEGUE_GEMELOS:
+                if (sol[v[5]]) sol[v[2]] = sol[v[3]] = sol[v[4]] = 1;
+                else sol[v[0]] = sol[v[1]] = 1;
+                break;
+        }
+    }
+
+    original.limpiar();
+    int tamano = 0;
+    for (int i = 0; i < n_original; ++i) {
+        if (sol[i]) {
+            original[i] = true;
+            tamano++;
+        }
+    }
+    return tamano;
+}
@@ -0,0 +1,92 @@
+#ifndef REDUCCION_H
+#define REDUCCION_H
+
+#include <cstdint>
+#include <vector>
+#include "Cromosoma.h"
+#include "Grafo.h"
+
+/**
+ * @brief Kernelización exacta para conjunto independiente máximo
+ *
+ * Aplica reglas que preservan el óptimo, α(G) = α(kernel) + desplazamiento:
+ * - grado 0 y grado 1: el vértice entra en la solución
+ * - grado 2: si sus vecinos son adyacentes entra el vértice; si no, v y
+ *   sus vecinos u, w se pliegan en un vértice nuevo adyacente a
+ *   N(u) ∪ N(w) \ {v}
+ * - dominación: si N[u] ⊆ N[v] para un vecino u, v sale del grafo
+ * - gemelos: dos vértices de grado 3 con la misma vecindad {a, b, c};
+ *   si hay una arista entre a, b, c entran ambos, si no se pliegan los
+ *   cinco en un vértice nuevo adyacente a N(a) ∪ N(b) ∪ N(c)
+ *
+ * Trabaja con una cola de vértices cuyo grado cambió, así que cada regla
+ * se revisa solo donde pudo volverse aplicable. Los pliegues y la
+ * dominación tienen un tope de trabajo por vértice (LIMITE_PLIEGUE,
+ * LIMITE_DOMINACION): saltearse una reducción nunca rompe la exactitud,
+ * solo deja un kernel algo más grande, y el total queda casi lineal.
+ *
+ * Las operaciones quedan registradas en orden; reconstruir() las deshace
+ * al revés para llevar una solución del kernel al grafo original.
+ */
+class Reduccion {
+public:
+    struct Estadisticas {
+        int nodos_original = 0;
+        int64_t aristas_original = 0;
+        int nodos_kernel = 0;
+        int64_t aristas_kernel = 0;
+        int incluidos = 0;          // grado 0/1/2 y gemelos con arista
+        int pliegues_grado2 = 0;
+        int pliegues_gemelos = 0;
+        int dominados = 0;
+        int desplazamiento = 0;
+    };
+
+    static constexpr int LIMITE_PLIEGUE = 256;      // grado máximo de los vértices plegados
+    static constexpr int LIMITE_DOMINACION = 256;   // grado máximo para revisar dominación en cada cambio
+
+    /**
+     * @brief Reduce el grafo (no lo modifica; el kernel es una copia)
+     */
+    explicit Reduccion(const Grafo& grafo);
+
+    const Grafo& kernel() const { return nucleo; }
+
+    /**
+     * @brief Vértices que la reducción ya garantiza en la solución
+     */
+    int desplazamiento() const { return offset; }
+
+    const Estadisticas& estadisticas() const { return stats; }
+
+    /**
+     * @brief Lleva una solución del kernel al grafo original
+     * @param bits_kernel Cromosoma empaquetado sobre los nodos del kernel
+     * @param original Cromosoma de grafo.n bits (se sobrescribe)
+     * @return Tamaño de la solución original (tamaño en el kernel + desplazamiento
+     *         si bits_kernel es independiente)
+     */
+    int reconstruir(const uint64_t* bits_kernel, Cromosoma& original) const;
+
+private:
+    enum class TipoOperacion { INCLUIR, PLIEGUE_GRADO2, PLIEGUE_GEMELOS };
+
+    // Vértices en ids de trabajo: los originales conservan su id y los
+    // creados por pliegues se numeran desde n
+    struct Operacion {
+        TipoOperacion tipo;
+        int v[6];  // INCLUIR: v; GRADO2: v, u, w, nuevo; GEMELOS: x, y, a, b, c, nuevo
+    };
+
+    struct GrafoTrabajo;  // grafo mutable donde se aplican las reglas (Reduccion.cpp)
+
+    int n_original;
+    int total_ids;
+    Grafo nucleo;
+    std::vector<int> id_trabajo;       // nodo del kernel -> id de trabajo
+    std::vector<Operacion> operaciones;
+    int offset;
+    Estadisticas stats;
+};
+
+#endif // REDUCCION_H
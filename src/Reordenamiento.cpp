@@ -0,0 +1,114 @@
+#include "Reordenamiento.h"
+#include "Rng.h"
+#include <algorithm>
+#include <numeric>
+
+namespace {
+
+// Vértices por grado ascendente (a igual grado, por id): counting sort
+std::vector<int> porGrado(const Grafo& grafo) {
+    int grado_max = 0;
+    for (int u = 0; u < grafo.n; ++u) grado_max = std::max(grado_max, grafo.grado(u));
+    std::vector<int> inicio(grado_max + 2, 0);
+    for (int u = 0; u < grafo.n; ++u) inicio[grafo.grado(u) + 1]++;
+    std::partial_sum(inicio.begin(), inicio.end(), inicio.begin());
+    std::vector<int> orden(grafo.n);
+    for (int u = 0; u < grafo.n; ++u) orden[inicio[grafo.grado(u)]++] = u;
+    return orden;
+}
+
+// Cuthill-McKee: BFS desde el vértice no visitado de menor grado de cada
+// componente, encolando los vecinos por grado ascendente; después se
+// invierte el orden completo
+std::vector<int> cuthillMcKee(const Grafo& grafo) {
+    std::vector<int> orden;
+    orden.reserve(grafo.n);
+    std::vector<char> visto(grafo.n, 0);
+    std::vector<int> vecinos;
+    for (int raiz : porGrado(grafo)) {
+        if (visto[raiz]) continue;
+        visto[raiz] = 1;
+        size_t cabeza = orden.size();
+        orden.push_back(raiz);
+        while (cabeza < orden.size()) {
+            int u = orden[cabeza++];
+            vecinos.clear();
+            for (int v : grafo.vecinosDe(u)) {
+                if (!visto[v]) {
+                    visto[v] = 1;
+                    vecinos.push_back(v);
+                }
+            }
+            std::sort(vecinos.begin(), vecinos.end(), [&](int a, int b) {
+                return grafo.grado(a) != grafo.grado(b) ? grafo.grado(a) < grafo.grado(b) : a < b;
+            });
+            orden.insert(orden.end(), vecinos.begin(), vecinos.end());
+        }
+    }
+    std::reverse(orden.begin(), orden.end());
+    return orden;
+}
+
+} // namespace
+
+std::vector<int> Reordenamiento::permutacion(const Grafo& grafo, OrdenVertices orden, uint64_t semilla) {
+    std::vector<int> secuencia;
+    switch (orden) {
+        case OrdenVertices::ORIGINAL:
+            secuencia.resize(grafo.n);
+            std::iota(secuencia.begin(), secuencia.end(), 0);
+            break;
+        case OrdenVertices::GRADO:
+            secuencia = porGrado(grafo);
+            break;
+        case OrdenVertices::RCM:
+            secuencia = cuthillMcKee(grafo);
+            break;
+        case OrdenVertices::ALEATORIO: {
+            secuencia.resize(grafo.n);
+            std::iota(secuencia.begin(), secuencia.end(), 0);
+            Rng gen(Rng::Tipo::XOSHIRO256, semilla);
+            for (int i = grafo.n - 1; i > 0; --i) {
+                std::swap(secuencia[i], secuencia[gen() % (i + 1)]);
+            }
+            break;
+        }
+    }
+
+    std::vector<int> nuevo_id(grafo.n);
+    for (int i = 0; i < grafo.n; ++i) nuevo_id[secuencia[i]] = i;
+    return nuevo_id;
+}
+
+Grafo Reordenamiento::aplicar(const Grafo& grafo, const std::vector<int>& nuevo_id) {
+    std::vector<int> viejo_id(grafo.n);
+    for (int u = 0; u < grafo.n; ++u) viejo_id[nuevo_id[u]] = u;
+
+    Grafo reordenado;
+    reordenado.n = grafo.n;
+    reordenado.offsets.resize(grafo.n + 1);
+    reordenado.vecinos.resize(grafo.vecinos.size());
+    int64_t pos = 0;
+    for (int i = 0; i < grafo.n; ++i) {
+        reordenado.offsets[i] = pos;
+        int* fila = reordenado.vecinos.data() + pos;
+        for (int v : grafo.vecinosDe(viejo_id[i])) reordenado.vecinos[pos++] = nuevo_id[v];
+        std::sort(fila, reordenado.vecinos.data() + pos);
+    }
+    reordenado.offsets[grafo.n] = pos;
+
+    if (Grafo::convieneMatrizBits(reordenado.n, reordenado.numAristas())) {
+        reordenado.construirMatrizBits();
+    }
+    return reordenado;
+}
+
+const char* Reordenamiento::nombre(OrdenVertices orden) {
+    switch (orden) {
+        case OrdenVertices::ORIGINAL: return "original";
+        case OrdenVertices::GRADO: return "degree";
+        case OrdenVertices::RCM: return "rcm";
+        case OrdenVertices::ALEATORIO: return "random";
+    }
+    return "?";
+}
@@ -0,0 +1,41 @@
+#ifndef REORDENAMIENTO_H
+#define REORDENAMIENTO_H
+
+#include <cstdint>
+#include <vector>
+#include "Grafo.h"
+#include "Parametros.h"
+
+/**
+ * @brief Renumeración de vértices (--order)
+ *
+ * El GA corre sobre una copia del grafo con los ids permutados y la mejor
+ * solución se devuelve con los ids del archivo. La numeración define la
+ * prioridad de la reparación (en cada conflicto queda el vértice de menor
+ * id) y qué tan cerca en memoria quedan las filas de vecinos que se
+ * recorren juntas.
+ */
+class Reordenamiento {
+public:
+    /**
+     * @brief Calcula la permutación para una política de orden
+     * @param grafo Grafo con los ids originales
+     * @param orden Política (ORIGINAL devuelve la identidad)
+     * @param semilla Semilla de la permutación ALEATORIO
+     * @return nuevo_id[u] = id de u en el grafo reordenado
+     */
+    static std::vector<int> permutacion(const Grafo& grafo, OrdenVertices orden, uint64_t semilla);
+
+    /**
+     * @brief Grafo con los ids permutados (CSR ordenado y matriz de bits
+     *        si corresponde)
+     */
+    static Grafo aplicar(const Grafo& grafo, const std::vector<int>& nuevo_id);
+
+    /**
+     * @brief Nombre de la política ("original", "degree", "rcm", "random")
+     */
+    static const char* nombre(OrdenVertices orden);
+};
+
+#endif // REORDENAMIENTO_H
@@ -0,0 +1,222 @@
+#include "Rng.h"
+#include <algorithm>
+#include <sstream>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define RNG_X86 1
+#endif
+
+namespace {
+
+// SplitMix64: expande una semilla de 64 bits al estado de xoshiro
+uint64_t splitmix64(uint64_t& x) {
+    uint64_t z = (x += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+// Constantes de Philox4x32 (Salmon et al., "Parallel random numbers: as
+// easy as 1, 2, 3", SC'11): multiplicadores y pasos de la clave
+constexpr uint32_t PHILOX_M0 = 0xD2511F53;
+constexpr uint32_t PHILOX_M1 = 0xCD9E8D57;
+constexpr uint32_t PHILOX_W0 = 0x9E3779B9;
+constexpr uint32_t PHILOX_W1 = 0xBB67AE85;
+constexpr int PHILOX_RONDAS = 10;
+
+// Bloques consecutivos que llenar() calcula juntos: las L rondas
+// independientes en arreglos separados se vectorizan (pmuludq)
+constexpr int PHILOX_LOTE = 8;
+
+// Philox4x32-10 de los contadores (bloque + l, flujo), l < L; el bloque l
+// deja sus 128 bits en destino[2l] y destino[2l + 1]
+template <int L>
+inline __attribute__((always_inline)) void philoxBloques(uint64_t clave, uint64_t bloque, uint64_t flujo, uint64_t* destino) {
+    uint32_t c0[L], c1[L], c2[L], c3[L];
+    for (int l = 0; l < L; ++l) {
+        c0[l] = static_cast<uint32_t>(bloque + l);
+        c1[l] = static_cast<uint32_t>((bloque + l) >> 32);
+        c2[l] = static_cast<uint32_t>(flujo);
+        c3[l] = static_cast<uint32_t>(flujo >> 32);
+    }
+    uint32_t k0 = static_cast<uint32_t>(clave);
+    uint32_t k1 = static_cast<uint32_t>(clave >> 32);
+    for (int r = 0; r < PHILOX_RONDAS; ++r) {
+        for (int l = 0; l < L; ++l) {
+            uint64_t p0 = static_cast<uint64_t>(PHILOX_M0) * c0[l];
+            uint64_t p1 = static_cast<uint64_t>(PHILOX_M1) * c2[l];
+            uint32_t n0 = static_cast<uint32_t>(p1 >> 32) ^ c1[l] ^ k0;
+            uint32_t n2 = static_cast<uint32_t>(p0 >> 32) ^ c3[l] ^ k1;
+            c0[l] = n0;
+            c1[l] = static_cast<uint32_t>(p1);
+            c2[l] = n2;
+            c3[l] = static_cast<uint32_t>(p0);
+        }
+        k0 += PHILOX_W0;
+        k1 += PHILOX_W1;
+    }
+    for (int l = 0; l < L; ++l) {
+        destino[2 * l] = c0[l] | (static_cast<uint64_t>(c1[l]) << 32);
+        destino[2 * l + 1] = c2[l] | (static_cast<uint64_t>(c3[l]) << 32);
+    }
+}
+
+void philoxLoteEscalar(uint64_t clave, uint64_t bloque, uint64_t flujo, uint64_t* destino) {
+    philoxBloques<PHILOX_LOTE>(clave, bloque, flujo, destino);
+}
+
+#ifdef RNG_X86
+// Las mismas rondas con vpmuludq de 4 carriles de 64 bits
+__attribute__((target("avx2")))
+void philoxLoteAvx2(uint64_t clave, uint64_t bloque, uint64_t flujo, uint64_t* destino) {
+    philoxBloques<PHILOX_LOTE>(clave, bloque, flujo, destino);
+}
+#endif
+
+using FuncionPhilox = void (*)(uint64_t, uint64_t, uint64_t, uint64_t*);
+
+FuncionPhilox elegirPhilox() {
+#ifdef RNG_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) return philoxLoteAvx2;
+#endif
+    return philoxLoteEscalar;
+}
+
+FuncionPhilox philoxLote = elegirPhilox();
+
+} // namespace
+
+Rng::Rng(Tipo tipo, uint64_t semilla) : tipo(tipo) {
+    sembrar(semilla);
+}
+
+void Rng::sembrar(uint64_t semilla) {
+    if (tipo == Tipo::XOSHIRO256) {
+        uint64_t x = semilla;
+        for (int i = 0; i < 4; ++i) s[i] = splitmix64(x);
+    } else if (tipo == Tipo::PHILOX4X32) {
+        clave = semilla;
+        bloque = 0;
+        numero_flujo = 0;
+        pos_philox = 2;
+    } else {
+        mt.seed(semilla);
+    }
+}
+
+void Rng::philox(uint64_t clave, uint64_t bloque, uint64_t flujo, uint64_t salida[2]) {
+    philoxBloques<1>(clave, bloque, flujo, salida);
+}
+
+void Rng::llenar(uint64_t* destino, size_t cantidad) {
+    size_t i = 0;
+    switch (tipo) {
+        case Tipo::XOSHIRO256:
+            for (; i < cantidad; ++i) destino[i] = siguienteXoshiro();
+            return;
+        case Tipo::PHILOX4X32:
+            // Lo que quede del bloque en curso, luego bloques enteros
+            // escritos directamente en el destino
+            while (i < cantidad && pos_philox < 2) destino[i++] = salida[pos_philox++];
+            for (; i + 2 * PHILOX_LOTE <= cantidad; i += 2 * PHILOX_LOTE) {
+                philoxLote(clave, bloque, numero_flujo, destino + i);
+                bloque += PHILOX_LOTE;
+            }
+            for (; i + 2 <= cantidad; i += 2) philox(clave, bloque++, numero_flujo, destino + i);
+            if (i < cantidad) destino[i] = siguientePhilox();
+            return;
+        default:
+            for (; i < cantidad; ++i) destino[i] = mt();
+            return;
+    }
+}
+
+void Rng::indices(int* destino, size_t cantidad, uint32_t limite) {
+    __extension__ typedef unsigned __int128 u128;
+    uint64_t bits[64];
+    for (size_t i = 0; i < cantidad; i += 64) {
+        size_t k = std::min<size_t>(64, cantidad - i);
+        llenar(bits, k);
+        for (size_t j = 0; j < k; ++j) {
+            destino[i + j] = static_cast<int>((static_cast<u128>(bits[j]) * limite) >> 64);
+        }
+    }
+}
+
+Rng Rng::flujo(Tipo tipo, uint64_t semilla, uint64_t numero) {
+    if (tipo != Tipo::PHILOX4X32) return Rng(tipo, derivarSemilla(semilla, numero));
+    Rng gen(tipo, semilla);
+    gen.numero_flujo = numero;
+    return gen;
+}
+
+uint64_t Rng::derivarSemilla(uint64_t base, uint64_t flujo) {
+    uint64_t x = base ^ (flujo * 0xD1B54A32D192ED03ULL);
+    splitmix64(x);
+    return splitmix64(x);
+}
+
+bool Rng::tipoDesdeNombre(const std::string& nombre, Tipo& tipo) {
+    if (nombre == "mt19937_64") {
+        tipo = Tipo::MT19937_64;
+    } else if (nombre == "xoshiro" || nombre == "xoshiro256") {
+        tipo = Tipo::XOSHIRO256;
+    } else if (nombre == "philox" || nombre == "philox4x32") {
+        tipo = Tipo::PHILOX4X32;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+const char* Rng::nombreTipo(Tipo tipo) {
+    switch (tipo) {
+        case Tipo::MT19937_64: return "mt19937_64";
+        case Tipo::XOSHIRO256: return "xoshiro256";
+        case Tipo::PHILOX4X32: return "philox4x32";
+    }
+    return "?";
+}
+
+void Rng::guardarEstado(std::vector<uint64_t>& palabras) const {
+    palabras.clear();
+    if (tipo == Tipo::XOSHIRO256) {
+        palabras.assign(s, s + 4);
+        return;
+    }
+    if (tipo == Tipo::PHILOX4X32) {
+        palabras = {clave, bloque, numero_flujo, static_cast<uint64_t>(pos_philox)};
+        return;
+    }
+    // Representación textual de la biblioteca: las 312 palabras de estado
+    // (libstdc++ agrega además la posición actual)
+    std::stringstream texto;
+    texto << mt;
+    uint64_t x;
+    while (texto >> x) palabras.push_back(x);
+}
+
+bool Rng::cargarEstado(const std::vector<uint64_t>& palabras) {
+    if (tipo == Tipo::XOSHIRO256) {
+        if (palabras.size() != 4) return false;
+        for (int i = 0; i < 4; ++i) s[i] = palabras[i];
+        return true;
+    }
+    if (tipo == Tipo::PHILOX4X32) {
+        if (palabras.size() != 4 || palabras[3] > 2 || (palabras[3] < 2 && palabras[1] == 0)) return false;
+        clave = palabras[0];
+        bloque = palabras[1];
+        numero_flujo = palabras[2];
+        pos_philox = static_cast<int>(palabras[3]);
+        // El bloque en curso se recalcula: es función del contador
+        if (pos_philox < 2) philox(clave, bloque - 1, numero_flujo, salida);
+        return true;
+    }
+    if (palabras.size() < std::mt19937_64::state_size ||
+        palabras.size() > std::mt19937_64::state_size + 1) return false;
+    std::stringstream texto;
+    for (uint64_t x : palabras) texto << x << ' ';
+    texto >> mt;
+    return !texto.fail();
+}
@@ -0,0 +1,164 @@
+#ifndef RNG_H
+#define RNG_H
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Generador de números aleatorios intercambiable
+ *
+ * Cumple con UniformRandomBitGenerator (64 bits por llamada), así que puede
+ * usarse directamente con las distribuciones de <random>. El motor concreto
+ * se elige en tiempo de ejecución:
+ * - MT19937_64: std::mt19937_64 (referencia, más lento)
+ * - XOSHIRO256: xoshiro256** (estado de 32 bytes, muy rápido)
+ * - PHILOX4X32: Philox4x32-10, basado en contador: el bloque i de un flujo
+ *   es una función pura de (semilla, flujo, i), así que los flujos se
+ *   separan sin solaparse y sin estado que avanzar
+ */
+class Rng {
+public:
+    enum class Tipo { MT19937_64, XOSHIRO256, PHILOX4X32 };
+
+    using result_type = uint64_t;
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return ~0ULL; }
+
+    explicit Rng(Tipo tipo = Tipo::MT19937_64, uint64_t semilla = 5489);
+
+    /**
+     * @brief Reinicia el estado del motor a partir de una semilla
+     */
+    void sembrar(uint64_t semilla);
+
+    result_type operator()() {
+        switch (tipo) {
+            case Tipo::XOSHIRO256: return siguienteXoshiro();
+            case Tipo::PHILOX4X32: return siguientePhilox();
+            default: return mt();
+        }
+    }
+
+    /**
+     * @brief Llena 'cantidad' palabras de 64 bits aleatorios
+     *
+     * Produce exactamente los mismos números que 'cantidad' llamadas a
+     * operator(), pero sin despachar por tipo en cada palabra (y, con
+     * Philox, generando los bloques de a varios).
+     */
+    void llenar(uint64_t* destino, size_t cantidad);
+
+    /**
+     * @brief Entero uniforme en [0, limite), limite > 0
+     *
+     * Multiplica 64 bits aleatorios por 'limite' y se queda con la parte
+     * alta (Lemire): un solo número por índice y sin divisiones. El sesgo
+     * es a lo sumo limite / 2^64.
+     */
+    uint32_t acotado(uint32_t limite) {
+        __extension__ typedef unsigned __int128 u128;  // -pedantic: extensión de GCC/Clang
+        return static_cast<uint32_t>((static_cast<u128>((*this)()) * limite) >> 64);
+    }
+
+    /**
+     * @brief Llena 'cantidad' índices uniformes en [0, limite), como acotado()
+     */
+    void indices(int* destino, size_t cantidad, uint32_t limite);
+
+    /**
+     * @brief Real uniforme en [0, 1) con 53 bits de precisión
+     */
+    double uniforme() {
+        return static_cast<double>((*this)() >> 11) * 0x1.0p-53;
+    }
+
+    Tipo obtenerTipo() const { return tipo; }
+
+    /**
+     * @brief Estado completo del motor como palabras de 64 bits
+     *
+     * Para MT19937_64, las palabras de su representación textual (312 de
+     * estado, más la posición en libstdc++); para XOSHIRO256, 4; para
+     * PHILOX4X32, 4 (clave, bloque, flujo y posición en el bloque).
+     * cargarEstado() sobre un motor del mismo tipo continúa exactamente la
+     * misma secuencia.
+     */
+    void guardarEstado(std::vector<uint64_t>& palabras) const;
+
+    /**
+     * @return false si las palabras no corresponden al tipo del motor
+     */
+    bool cargarEstado(const std::vector<uint64_t>& palabras);
+
+    /**
+     * @brief Deriva la semilla de un flujo independiente (p. ej. un hilo)
+     *
+     * Mezcla la semilla base con el número de flujo usando SplitMix64, de
+     * modo que una misma semilla base siempre produce los mismos flujos.
+     */
+    static uint64_t derivarSemilla(uint64_t base, uint64_t flujo);
+
+    /**
+     * @brief Motor del flujo 'numero' de una semilla (un hilo, una fila)
+     *
+     * Con PHILOX4X32 el número de flujo va en la mitad alta del contador y
+     * la semilla es la clave: los flujos son disjuntos por construcción.
+     * Con los demás motores equivale a sembrar con derivarSemilla(semilla,
+     * numero). El flujo 0 de PHILOX4X32 es Rng(PHILOX4X32, semilla).
+     */
+    static Rng flujo(Tipo tipo, uint64_t semilla, uint64_t numero);
+
+    /**
+     * @brief Traduce un nombre de línea de comandos a un tipo de motor
+     * @return true si el nombre es válido
+     */
+    static bool tipoDesdeNombre(const std::string& nombre, Tipo& tipo);
+
+    static const char* nombreTipo(Tipo tipo);
+
+private:
+    uint64_t siguienteXoshiro() {
+        const uint64_t resultado = rotl(s[1] * 5, 7) * 9;
+        const uint64_t t = s[1] << 17;
+        s[2] ^= s[0];
+        s[3] ^= s[1];
+        s[1] ^= s[2];
+        s[0] ^= s[3];
+        s[2] ^= t;
+        s[3] = rotl(s[3], 45);
+        return resultado;
+    }
+
+    static uint64_t rotl(uint64_t x, int k) {
+        return (x << k) | (x >> (64 - k));
+    }
+
+    uint64_t siguientePhilox() {
+        if (pos_philox == 2) {
+            philox(clave, bloque++, numero_flujo, salida);
+            pos_philox = 0;
+        }
+        return salida[pos_philox++];
+    }
+
+    /**
+     * @brief Philox4x32-10 del contador (bloque, flujo): 128 bits en 'salida'
+     */
+    static void philox(uint64_t clave, uint64_t bloque, uint64_t flujo, uint64_t salida[2]);
+
+    Tipo tipo;
+    std::mt19937_64 mt;
+    uint64_t s[4];
+
+    // PHILOX4X32: 'salida' es el bloque anterior a 'bloque', consumido hasta pos_philox
+    uint64_t clave = 0;
+    uint64_t bloque = 0;
+    uint64_t numero_flujo = 0;
+    uint64_t salida[2] = {0, 0};
+    int pos_philox = 2;
+};
+
+#endif // RNG_H
@@ -0,0 +1,218 @@
+#include "Servidor.h"
+#include "AlgoritmoGenetico.h"
+#include "Argumentos.h"
+#include "CacheGrafos.h"
+#include <algorithm>
+#include <cerrno>
+#include <condition_variable>
+#include <csignal>
+#include <cstring>
+#include <deque>
+#include <iostream>
+#include <mutex>
+#include <streambuf>
+#include <thread>
+#include <vector>
+
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace {
+
+volatile std::sig_atomic_t detener = 0;
+
+void manejarSenal(int) { detener = 1; }
+
+// streambuf sobre un socket: cada endl (o buffer lleno) se envía de
+// inmediato, así el cliente ve el reporte any-time a medida que ocurre.
+// Si el cliente se desconecta, lo que queda se descarta en silencio.
+class BufferSocket : public std::streambuf {
+public:
+    explicit BufferSocket(int fd) : fd(fd), roto(false) {
+        setp(buffer, buffer + sizeof(buffer));
+    }
+    ~BufferSocket() override { sync(); }
+
+protected:
+    int_type overflow(int_type c) override {
+        vaciar();
+        if (!traits_type::eq_int_type(c, traits_type::eof())) {
+            *pptr() = traits_type::to_char_type(c);
+            pbump(1);
+        }
+        return traits_type::not_eof(c);
+    }
+
+    int sync() override {
+        vaciar();
+        return 0;
+    }
+
+private:
+    void vaciar() {
+        const char* p = pbase();
+        size_t pendiente = pptr() - pbase();
+        while (!roto && pendiente > 0) {
+            ssize_t escritos = send(fd, p, pendiente, MSG_NOSIGNAL);
+            if (escritos <= 0) {
+                roto = true;
+                break;
+            }
+            p += escritos;
+            pendiente -= static_cast<size_t>(escritos);
+        }
+        setp(buffer, buffer + sizeof(buffer));
+    }
+
+    int fd;
+    bool roto;
+    char buffer[4096];
+};
+
+// Lee la línea del pedido (hasta '\n' o el cierre de escritura del cliente)
+bool leerPedido(int fd, std::string& linea) {
+    static constexpr size_t MAX_PEDIDO = 64 * 1024;
+    char buf[1024];
+    while (linea.size() < MAX_PEDIDO) {
+        ssize_t leidos = recv(fd, buf, sizeof(buf), 0);
+        if (leidos < 0) return false;
+        if (leidos == 0) return !linea.empty();
+        linea.append(buf, static_cast<size_t>(leidos));
+        size_t fin = linea.find('\n');
+        if (fin != std::string::npos) {
+            linea.resize(fin);
+            return true;
+        }
+    }
+    return false;
+}
+
+void atender(int fd, const ParametrosGA& base, CacheGrafos& grafos) {
+    BufferSocket buffer(fd);
+    std::ostream out(&buffer);
+
+    std::string linea;
+    if (!leerPedido(fd, linea)) {
+        out << "ERROR: pedido ilegible" << std::endl;
+        return;
+    }
+
+    // Un cliente no debe escribir archivos del servidor ni anidar modos
+    static const std::vector<std::string> PROHIBIDAS = {
+        "--checkpoint", "--resume", "--stats", "--serve", "--batch"};
+
+    ParametrosGA params = base;
+    std::string error;
+    std::vector<std::string> args = Argumentos::separar(linea);
+    std::string prohibida = Argumentos::buscarOpcion(args, PROHIBIDAS);
+    ResultadoArgs r = Argumentos::parsear(args, params, error);
+    if (r == ResultadoArgs::AYUDA) {
+        error = "opción -h no válida en un pedido";
+    } else if (!prohibida.empty()) {
+        error = "opción " + prohibida + " no válida en un pedido";
+    } else if (r == ResultadoArgs::OK) {
+        if (params.instancia.empty()) error = "falta -i <archivo>";
+        else if (params.max_time <= 0) error = "tiempo inválido";
+    }
+    if (!error.empty()) {
+        out << "ERROR: " << error << std::endl;
+        return;
+    }
+
+    std::shared_ptr<const Grafo> grafo = grafos.obtener(params.instancia, params.usar_cache);
+    if (!grafo) {
+        out << "ERROR: no se pudo cargar " << params.instancia << std::endl;
+        return;
+    }
+
+    ResultadoGA resultado = AlgoritmoGenetico::resolver(*grafo, params, out);
+    if (!resultado.error.empty()) {
+        out << "ERROR: " << resultado.error << std::endl;
+        return;
+    }
+    AlgoritmoGenetico::reportarFinal(out, resultado);
+}
+
+} // namespace
+
+int Servidor::ejecutar(const std::string& ruta_socket, const ParametrosGA& base, int trabajadores) {
+    sockaddr_un dir{};
+    if (ruta_socket.size() >= sizeof(dir.sun_path)) {
+        std::cerr << "Error: Ruta de socket demasiado larga: " << ruta_socket << std::endl;
+        return 1;
+    }
+    dir.sun_family = AF_UNIX;
+    std::strcpy(dir.sun_path, ruta_socket.c_str());
+
+    int escucha = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (escucha < 0) {
+        std::cerr << "Error: socket(): " << std::strerror(errno) << std::endl;
+        return 1;
+    }
+    unlink(ruta_socket.c_str());
+    if (bind(escucha, reinterpret_cast<sockaddr*>(&dir), sizeof(dir)) < 0 || listen(escucha, 128) < 0) {
+        std::cerr << "Error: No se pudo escuchar en " << ruta_socket << ": "
+                  << std::strerror(errno) << std::endl;
+        close(escucha);
+        return 1;
+    }
+
+    struct sigaction accion{};
+    accion.sa_handler = manejarSenal;
+    sigemptyset(&accion.sa_mask);
+    sigaction(SIGINT, &accion, nullptr);
+    sigaction(SIGTERM, &accion, nullptr);
+
+    CacheGrafos grafos;
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::deque<int> cola;
+    bool cerrar = false;
+
+    std::vector<std::thread> hilos;
+    for (int i = 0; i < std::max(1, trabajadores); ++i) {
+        hilos.emplace_back([&]() {
+            while (true) {
+                int fd;
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    cv.wait(lock, [&]() { return cerrar || !cola.empty(); });
+                    if (cola.empty()) return;
+                    fd = cola.front();
+                    cola.pop_front();
+                }
+                atender(fd, base, grafos);
+                close(fd);
+            }
+        });
+    }
+
+    std::cerr << "Servidor escuchando en " << ruta_socket << " ("
+              << std::max(1, trabajadores) << " trabajadores)" << std::endl;
+
+    // poll con timeout: así la señal se nota aunque no lleguen conexiones
+    pollfd pfd{escucha, POLLIN, 0};
+    while (!detener) {
+        int listos = poll(&pfd, 1, 200);
+        if (listos <= 0) continue;
+        int fd = accept(escucha, nullptr, nullptr);
+        if (fd < 0) continue;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            cola.push_back(fd);
+        }
+        cv.notify_one();
+    }
+
+    close(escucha);
+    unlink(ruta_socket.c_str());
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        cerrar = true;
+    }
+    cv.notify_all();
+    for (std::thread& t : hilos) t.join();
+    return 0;
+}
@@ -0,0 +1,34 @@
+#ifndef SERVIDOR_H
+#define SERVIDOR_H
+
+#include <string>
+#include "Parametros.h"
+
+/**
+ * @brief Modo servidor (--serve): corridas del GA a pedido por un socket Unix
+ *
+ * Cada conexión envía una línea con las opciones de la corrida (las mismas
+ * de la línea de comandos; las de ./ga --serve son la base) y recibe la
+ * misma salida que imprimiría ./ga: la solución inicial, cada mejora a
+ * medida que ocurre y la línea final. Si el pedido no es válido la
+ * respuesta es una sola línea "ERROR: <motivo>". Luego se cierra la
+ * conexión.
+ *
+ * Los grafos quedan cargados entre pedidos (CacheGrafos) y 'trabajadores'
+ * hilos atienden pedidos a la vez; los demás esperan en cola. SIGINT o
+ * SIGTERM cierran el socket y el servidor termina cuando se completan los
+ * pedidos ya aceptados.
+ */
+class Servidor {
+public:
+    /**
+     * @brief Atiende pedidos hasta recibir SIGINT o SIGTERM
+     * @param ruta_socket Ruta del socket (se reemplaza si ya existe)
+     * @param base Parámetros base de cada corrida
+     * @param trabajadores Corridas simultáneas
+     * @return 0 al terminar normalmente, 1 si no se pudo abrir el socket
+     */
+    static int ejecutar(const std::string& ruta_socket, const ParametrosGA& base, int trabajadores);
+};
+
+#endif // SERVIDOR_H
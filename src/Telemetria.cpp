@@ -0,0 +1,100 @@
+#include "Telemetria.h"
+#include <atomic>
+
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
+
+namespace {
+
+const int NUM_FASES = static_cast<int>(Fase::NUM_FASES);
+const int MAX_SLOTS = 64;  // con más hilos, los últimos comparten slot
+
+struct alignas(64) Slot {
+    std::atomic<uint64_t> nanosegundos[NUM_FASES];
+    std::atomic<uint64_t> llamadas[NUM_FASES];
+};
+
+Slot slots[MAX_SLOTS];
+std::atomic<int> siguiente_slot{0};
+std::atomic<bool> activa_global{false};
+
+Slot& slotDelHilo() {
+    thread_local int indice = -1;
+    if (indice < 0) {
+        indice = siguiente_slot.fetch_add(1, std::memory_order_relaxed);
+        if (indice >= MAX_SLOTS) indice = MAX_SLOTS - 1;
+    }
+    return slots[indice];
+}
+
+} // namespace
+
+void Telemetria::activar(bool valor) {
+    activa_global.store(valor && compilada, std::memory_order_relaxed);
+}
+
+bool Telemetria::activa() {
+    return activa_global.load(std::memory_order_relaxed);
+}
+
+void Telemetria::registrar(Fase fase, uint64_t nanosegundos, uint64_t llamadas) {
+    Slot& slot = slotDelHilo();
+    int f = static_cast<int>(fase);
+    slot.nanosegundos[f].fetch_add(nanosegundos, std::memory_order_relaxed);
+    slot.llamadas[f].fetch_add(llamadas, std::memory_order_relaxed);
+}
+
+Telemetria::ResumenFase Telemetria::resumen(Fase fase) {
+    int f = static_cast<int>(fase);
+    uint64_t ns = 0, llamadas = 0;
+    for (const Slot& slot : slots) {
+        ns += slot.nanosegundos[f].load(std::memory_order_relaxed);
+        llamadas += slot.llamadas[f].load(std::memory_order_relaxed);
+    }
+    return {ns / 1e9, llamadas};
+}
+
+void Telemetria::reiniciar() {
+    for (Slot& slot : slots) {
+        for (int f = 0; f < NUM_FASES; ++f) {
+            slot.nanosegundos[f].store(0, std::memory_order_relaxed);
+            slot.llamadas[f].store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+const char* Telemetria::nombreFase(Fase fase) {
+    switch (fase) {
+        case Fase::CARGA_GRAFO: return "carga_grafo";
+        case Fase::REDUCCION: return "reduccion";
+        case Fase::REORDEN: return "reorden";
+        case Fase::COMPONENTES: return "componentes";
+        case Fase::SEEDING: return "seeding";
+        case Fase::SELECCION: return "seleccion";
+        case Fase::CRUCE: return "cruce";
+        case Fase::MUTACION: return "mutacion";
+        case Fase::REPARACION: return "reparacion";
+        case Fase::BUSQUEDA_LOCAL: return "busqueda_local";
+        case Fase::REEMPLAZO: return "reemplazo";
+        case Fase::MEJOR: return "mejor";
+        case Fase::DIVERSIDAD: return "diversidad";
+        case Fase::MIGRACION: return "migracion";
+        case Fase::NUM_FASES: break;
+    }
+    return "?";
+}
+
+long Telemetria::rssPicoKb() {
+#ifndef _WIN32
+    struct rusage uso;
+    if (getrusage(RUSAGE_SELF, &uso) == 0) {
+#ifdef __APPLE__
+        return uso.ru_maxrss / 1024;  // bytes en macOS
+#else
+        return uso.ru_maxrss;         // KiB en Linux
+#endif
+    }
+#endif
+    return 0;
+}
@@ -0,0 +1,152 @@
+#ifndef TELEMETRIA_H
+#define TELEMETRIA_H
+
+#include <chrono>
+#include <cstdint>
+
+/**
+ * @brief Fases del algoritmo que se cronometran
+ */
+enum class Fase {
+    CARGA_GRAFO,
+    REDUCCION,
+    REORDEN,
+    COMPONENTES,
+    SEEDING,
+    SELECCION,
+    CRUCE,
+    MUTACION,
+    REPARACION,
+    BUSQUEDA_LOCAL,
+    REEMPLAZO,   // inserción de hijos en el modelo estacionario
+    MEJOR,       // seguimiento del mejor individuo
+    DIVERSIDAD,  // medidas de diversidad y política de reinicio
+    MIGRACION,
+    NUM_FASES
+};
+
+/**
+ * @brief Contadores de tiempo y llamadas por fase
+ *
+ * Cada hilo acumula en su propio slot (alineado a línea de caché) con
+ * atómicos relajados, así medir no introduce contención. Se compila solo
+ * con -DGA_TELEMETRIA (make TELEMETRIA=1, el default); sin la macro,
+ * CronometroFases queda vacío y el compilador elimina las mediciones.
+ * Con la macro, las mediciones solo corren si se llamó a activar().
+ */
+class Telemetria {
+public:
+    struct ResumenFase {
+        double segundos;      // suma sobre todos los hilos
+        uint64_t llamadas;
+    };
+
+#ifdef GA_TELEMETRIA
+    static constexpr bool compilada = true;
+#else
+    static constexpr bool compilada = false;
+#endif
+
+    static void activar(bool valor);
+    static bool activa();
+
+    static void registrar(Fase fase, uint64_t nanosegundos, uint64_t llamadas);
+    static ResumenFase resumen(Fase fase);
+    static void reiniciar();
+
+    static const char* nombreFase(Fase fase);
+
+    /**
+     * @brief Pico de memoria residente del proceso en KiB (0 si no se sabe)
+     */
+    static long rssPicoKb();
+};
+
+#ifdef GA_TELEMETRIA
+
+/**
+ * @brief Cronómetro por vueltas: marcar(f) asigna a la fase f el tiempo
+ *        transcurrido desde la marca anterior (o desde reiniciar())
+ *
+ * Acumula en variables locales y vuelca a Telemetria al destruirse, así
+ * el camino caliente no toca atómicos. Con periodo > 1 solo una de cada
+ * 'periodo' vueltas lee el reloj y su tiempo se escala por 'periodo'; las
+ * llamadas se cuentan siempre.
+ */
+class CronometroFases {
+public:
+    explicit CronometroFases(unsigned periodo = 1)
+        : activo(Telemetria::activa()), medir(activo),
+          periodo(periodo ? periodo : 1), vuelta(0), ns{}, llamadas{} {
+        if (activo) t = std::chrono::steady_clock::now();
+    }
+
+    ~CronometroFases() {
+        if (!activo) return;
+        for (int f = 0; f < NUM; ++f) {
+            if (llamadas[f]) Telemetria::registrar(static_cast<Fase>(f), ns[f], llamadas[f]);
+        }
+    }
+
+    CronometroFases(const CronometroFases&) = delete;
+    CronometroFases& operator=(const CronometroFases&) = delete;
+
+    /**
+     * @brief Empieza una vuelta sin asignar el tiempo transcurrido
+     */
+    void reiniciar() {
+        if (!activo) return;
+        medir = (vuelta++ % periodo == 0);
+        if (medir) t = std::chrono::steady_clock::now();
+    }
+
+    void marcar(Fase fase) {
+        if (!activo) return;
+        int f = static_cast<int>(fase);
+        llamadas[f]++;
+        if (!medir) return;
+        auto ahora = std::chrono::steady_clock::now();
+        ns[f] += periodo * static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(ahora - t).count());
+        t = ahora;
+    }
+
+    /**
+     * @brief Asigna a 'fase' todo el tiempo desde la última marca, sin
+     *        escalar por el período ni contar una llamada
+     *
+     * Para trabajo hecho una vez en lote (p. ej. los candidatos de todos
+     * los torneos de un bloque) cuyas llamadas se cuentan en las vueltas.
+     */
+    void sumar(Fase fase) {
+        if (!activo) return;
+        auto ahora = std::chrono::steady_clock::now();
+        ns[static_cast<int>(fase)] += static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(ahora - t).count());
+        t = ahora;
+    }
+
+private:
+    static const int NUM = static_cast<int>(Fase::NUM_FASES);
+    bool activo;
+    bool medir;
+    unsigned periodo;
+    unsigned vuelta;
+    std::chrono::steady_clock::time_point t;
+    uint64_t ns[NUM];
+    uint64_t llamadas[NUM];
+};
+
+#else
+
+class CronometroFases {
+public:
+    explicit CronometroFases(unsigned = 1) {}
+    void reiniciar() {}
+    void marcar(Fase) {}
+    void sumar(Fase) {}
+};
+
+#endif
+
+#endif // TELEMETRIA_H
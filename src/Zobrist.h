@@ -0,0 +1,53 @@
+#ifndef ZOBRIST_H
+#define ZOBRIST_H
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Hash Zobrist de cromosomas empaquetados, por palabra
+ *
+ * H(w) es el XOR de aporte(p, w[p]) sobre las palabras no nulas, con el
+ * aporte de cada palabra mezclado con una clave de su posición. Cambiar
+ * genes de una palabra cuesta dos mezclas (sacar el aporte viejo y poner
+ * el nuevo), así que una mutación es O(1) por gen invertido y un cruce o
+ * una reparación solo tocan las palabras que cambiaron. Las claves salen
+ * de splitmix64 al vuelo: no ocupan memoria y son las mismas en todas las
+ * corridas.
+ */
+class Zobrist {
+public:
+    static uint64_t aporte(size_t p, uint64_t palabra) {
+        if (!palabra) return 0;
+        uint64_t z = palabra ^ (static_cast<uint64_t>(p) * 0x9E3779B97F4A7C15ULL + 0x5A0B1C2D3E4F6071ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+
+    /**
+     * @brief Cambio del hash cuando la palabra p pasa de 'antes' a 'despues'
+     */
+    static uint64_t cambio(size_t p, uint64_t antes, uint64_t despues) {
+        return aporte(p, antes) ^ aporte(p, despues);
+    }
+
+    static uint64_t hash(const uint64_t* w, size_t num_palabras) {
+        uint64_t h = 0;
+        for (size_t p = 0; p < num_palabras; ++p) h ^= aporte(p, w[p]);
+        return h;
+    }
+
+    /**
+     * @brief H(a) ^ H(b), mezclando solo las palabras distintas
+     */
+    static uint64_t hashDiferencia(const uint64_t* a, const uint64_t* b, size_t num_palabras) {
+        uint64_t h = 0;
+        for (size_t p = 0; p < num_palabras; ++p) {
+            if (a[p] != b[p]) h ^= cambio(p, a[p], b[p]);
+        }
+        return h;
+    }
+};
+
+#endif // ZOBRIST_H
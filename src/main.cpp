@@ -1,6 +1,13 @@
 #include <iostream>
+#include <iomanip>
 #include <string>
+#include <thread>
+#include <algorithm>
 #include "AlgoritmoGenetico.h"
+#include "Argumentos.h"
+#include "Grafo.h"
+#include "Lote.h"
+#include "Servidor.h"
 
 using namespace std;
 
@@ -16,55 +23,104 @@ void mostrarUso() {
     cout << "  --k_greedy <K>      Parámetro greedy (default: 10)" << endl;
     cout << "  --seeding_rate <R>  Proporción de seeding (default: 0.2)" << endl;
     cout << "  --seed <S>          Seed aleatoria (default: -1 = aleatorio)" << endl;
+    cout << "  --rng <motor>       Generador aleatorio: mt19937_64 | xoshiro | philox (default: mt19937_64)" << endl;
+    cout << "  --model <m>         Reemplazo: generational | steady (peor reemplazado por cada hijo) (default: generational)" << endl;
+    cout << "  --threads <N>       Hilos para generar la descendencia (default: 1, 0 = todos)" << endl;
+    cout << "  --islands <K>       Modelo de islas con K subpoblaciones, un hilo por isla (default: 1)" << endl;
+    cout << "  --migration_interval <M>  Generaciones entre migraciones (default: 10)" << endl;
+    cout << "  --migrants <R>      Mejores individuos que emigran (default: 1)" << endl;
+    cout << "  --topology <T>      Topología de migración: ring | full (default: ring)" << endl;
+    cout << "  --local_search      Búsqueda local ARW (1-swap / (1,2)-swap) sobre la descendencia" << endl;
+    cout << "  --ls_budget <B>     Presupuesto de búsqueda local por generación, en recorridos del grafo (default: 4)" << endl;
+    cout << "  --reduce            Kernelización exacta (grado 0/1/2, dominación, gemelos) antes del GA" << endl;
+    cout << "  --components        Resolver cada componente conexa por separado (exactas si son chicas)" << endl;
+    cout << "  --order <o>         Renumerar vértices antes del GA: original, degree, rcm, random (default: original)" << endl;
+    cout << "  --eval_cache <N>    Cache de N reparaciones por hash Zobrist para hijos repetidos (default: 0 = sin cache)" << endl;
+    cout << "  --restart_diversity <D>     Reiniciar la población si la diversidad cae debajo de D (default: 0 = nunca)" << endl;
+    cout << "  --restart_stagnation <seg>  Reiniciar tras seg segundos sin mejora (default: 0 = nunca)" << endl;
+    cout << "  --restart_elite <K>         Mejores individuos conservados en un reinicio (default: 1)" << endl;
+    cout << "  --stats json        Al terminar, escribe la telemetría en stderr como un registro JSON" << endl;
+    cout << "  --checkpoint <archivo>      Guarda el estado de la corrida (periódicamente y al terminar)" << endl;
+    cout << "  --checkpoint_every <seg>    Segundos entre checkpoints (default: 60)" << endl;
+    cout << "  --resume <archivo>  Continúa la corrida de un checkpoint (-t y --max_gens cuentan lo ya corrido)" << endl;
+    cout << "  --no_cache          No leer ni escribir el cache binario <archivo>.csr" << endl;
+    cout << "  --max_gens <G>      Corta al llegar a G generaciones (default: -1 = solo por tiempo)" << endl;
+    cout << "  --mem_report        Reporta la memoria del grafo (CSR vs listas) y termina" << endl;
+    cout << "  --batch <archivo>   Corre cada línea del manifiesto (mismas opciones) cargando cada grafo una vez" << endl;
+    cout << "  --serve <socket>    Servidor de corridas en un socket Unix (cliente: tools/ga_cliente)" << endl;
+    cout << "  --jobs <N>          Corridas simultáneas en --batch y --serve (default: 1, 0 = todos los núcleos)" << endl;
+}
+
+int reportarMemoria(const string& instancia) {
+    Grafo grafo;
+    if (!grafo.cargarDesdeArchivo(instancia)) {
+        return 1;
+    }
+
+    size_t csr = grafo.memoriaCSR();
+    size_t listas = grafo.memoriaListasEstimada();
+    cout << "Instancia: " << instancia << endl;
+    cout << "Nodos: " << grafo.n << ", Aristas: " << grafo.numAristas() << endl;
+    cout << fixed << setprecision(2);
+    cout << "CSR (offsets + vecinos): " << csr << " bytes ("
+         << csr / (1024.0 * 1024.0) << " MiB)" << endl;
+    cout << "vector<vector<int>> (estimado): " << listas << " bytes ("
+         << listas / (1024.0 * 1024.0) << " MiB)" << endl;
+    cout << "Razon listas/CSR: " << static_cast<double>(listas) / csr << endl;
+    if (grafo.tieneMatrizBits()) {
+        size_t matriz = grafo.matriz_bits.capacity() * sizeof(uint64_t);
+        cout << "Matriz de bits (reparacion densa): " << matriz << " bytes ("
+             << matriz / (1024.0 * 1024.0) << " MiB)" << endl;
+    }
+    return 0;
 }
 
 int main(int argc, char** argv) {
     ParametrosGA params;
+    vector<string> args(argv + 1, argv + argc);
 
+    // Opciones del GA (compartidas con --batch)
+    string error;
+    ResultadoArgs r = Argumentos::parsear(args, params, error);
+    if (r == ResultadoArgs::AYUDA) {
+        mostrarUso();
+        return 0;
+    }
+    if (r == ResultadoArgs::ERROR) {
+        cerr << "Error: " << error << endl;
+        mostrarUso();
+        return 1;
+    }
 
-    bool usarBestP = false;
-    for (int i = 1; i < argc; ++i) {
-        string arg = argv[i];
-        if (arg == "--bestP") {
-            usarBestP = true;
-            break;
+    // Opciones propias del ejecutable
+    bool reporteMemoria = false;
+    string manifiesto;
+    string socket_servidor;
+    int trabajos = 1;
+    try {
+        for (size_t i = 0; i < args.size(); ++i) {
+            if (args[i] == "--mem_report") {
+                reporteMemoria = true;
+            } else if (args[i] == "--batch" && i + 1 < args.size()) {
+                manifiesto = args[++i];
+            } else if (args[i] == "--serve" && i + 1 < args.size()) {
+                socket_servidor = args[++i];
+            } else if (args[i] == "--jobs" && i + 1 < args.size()) {
+                trabajos = stoi(args[++i]);
+                if (trabajos <= 0) trabajos = max(1u, thread::hardware_concurrency());
+            }
         }
+    } catch (const exception&) {
+        cerr << "Error: Valor inválido para --jobs" << endl;
+        mostrarUso();
+        return 1;
     }
-    if (usarBestP) {
-        params.pop_size = 299;
-        params.p_cruce = 0.76;
-        params.p_mut = 0.14;
-        params.k_greedy = 11;
-        params.seeding_rate = 0.44;
+
+    if (!socket_servidor.empty()) {
+        return Servidor::ejecutar(socket_servidor, params, trabajos);
     }
-    // Parsear argumentos
-    for (int i = 1; i < argc; ++i) {
-        string arg = argv[i];
-        
-        if (arg == "-i" && i + 1 < argc) {
-            params.instancia = argv[++i];
-        } else if (arg == "-t" && i + 1 < argc) {
-            params.max_time = stod(argv[++i]);
-        } else if (arg == "--pop_size" && i + 1 < argc) {
-            params.pop_size = stoi(argv[++i]);
-        } else if (arg == "--p_cruce" && i + 1 < argc) {
-            params.p_cruce = stod(argv[++i]);
-        } else if (arg == "--p_mut" && i + 1 < argc) {
-            params.p_mut = stod(argv[++i]);
-        } else if (arg == "--k_greedy" && i + 1 < argc) {
-            params.k_greedy = stoi(argv[++i]);
-        } else if (arg == "--seeding_rate" && i + 1 < argc) {
-            params.seeding_rate = stod(argv[++i]);
-        } else if (arg == "--seed" && i + 1 < argc) {
-            params.seed = stoi(argv[++i]);
-        } else if (arg == "--help" || arg == "-h") {
-            mostrarUso();
-            return 0;
-        }else if (arg == "--bestP") {
-            // --- NUEVO ---
-            // Ya lo procesamos, no hacer nada.
-            ; 
-        }
+    if (!manifiesto.empty()) {
+        return Lote::ejecutar(manifiesto, params, trabajos, cout);
     }
 
     // Validar parámetros obligatorios
@@ -74,6 +130,10 @@ int main(int argc, char** argv) {
         return 1;
     }
     
+    if (reporteMemoria) {
+        return reportarMemoria(params.instancia);
+    }
+
     if (params.max_time <= 0) {
          cerr << "Error: Se requiere un tiempo de ejecución válido con -t <segundos>" << endl;
          mostrarUso();
@@ -81,7 +141,5 @@ int main(int argc, char** argv) {
     }
 
     // Ejecutar algoritmo
-    AlgoritmoGenetico::ejecutar(params);
-
-    return 0;
+    return AlgoritmoGenetico::ejecutar(params) ? 0 : 1;
 }
@@ -0,0 +1,72 @@
+#ifndef TESTS_COMUN_H
+#define TESTS_COMUN_H
+
+// Utilidades compartidas por los tests de tests/
+
+#include "Checkpoint.h"
+#include "Cromosoma.h"
+#include "Grafo.h"
+#include "Rng.h"
+#include <utility>
+#include <vector>
+
+namespace prueba {
+
+/**
+ * @brief Grafo aleatorio con n·grado_medio/2 aristas sorteadas (puede haber
+ *        lazos y repetidas: construirDesdeAristas las descarta)
+ */
+inline Grafo grafoAleatorio(int n, double grado_medio, uint64_t semilla) {
+    Rng gen(Rng::Tipo::XOSHIRO256, semilla);
+    std::vector<std::pair<int, int>> aristas;
+    long long m = static_cast<long long>(n * grado_medio / 2.0);
+    for (long long e = 0; e < m; ++e) {
+        aristas.emplace_back(gen() % n, gen() % n);
+    }
+    Grafo grafo;
+    grafo.construirDesdeAristas(n, aristas);
+    return grafo;
+}
+
+/**
+ * @brief ¿Las palabras 'w' son un conjunto independiente de 'fitness' vértices?
+ */
+inline bool valida(const Grafo& grafo, const uint64_t* w, int fitness) {
+    int cuenta = 0;
+    for (int u = 0; u < grafo.n; ++u) {
+        if (!((w[u >> 6] >> (u & 63)) & 1ULL)) continue;
+        cuenta++;
+        for (int v : grafo.vecinosDe(u)) {
+            if ((w[v >> 6] >> (v & 63)) & 1ULL) return false;
+        }
+    }
+    return cuenta == fitness;
+}
+
+/**
+ * @brief ¿'c' es un conjunto independiente de 'tamano' vértices?
+ */
+inline bool independiente(const Grafo& grafo, const Cromosoma& c, int tamano) {
+    int cuenta = 0;
+    for (int u = 0; u < grafo.n; ++u) {
+        if (!c[u]) continue;
+        cuenta++;
+        for (int v : grafo.vecinosDe(u)) {
+            if (c[v]) return false;
+        }
+    }
+    return cuenta == tamano;
+}
+
+/**
+ * @brief Misma población, fitness, contadores y generadores
+ */
+inline bool mismoEstado(const EstadoGA& a, const EstadoGA& b) {
+    return a.generaciones == b.generaciones && a.evaluaciones == b.evaluaciones
+        && a.cromosomas == b.cromosomas && a.fitness == b.fitness
+        && a.estados_rng == b.estados_rng;
+}
+
+} // namespace prueba
+
+#endif // TESTS_COMUN_H
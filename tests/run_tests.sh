@@ -107,6 +107,78 @@ else
     echo -e "${BLUE}Info: Dataset de grafos grandes no encontrado. Saltando pruebas de grafos grandes.${NC}"
 fi
 
+echo ""
+echo "=== MODO LOTE (--batch) ==="
+echo ""
+
+# Con seed fija y --max_gens la corrida es determinista: el lote debe dar
+# la misma calidad que cada corrida suelta
+echo -e "${BLUE}Test: Lote vs corridas sueltas${NC}"
+manifiesto=$(mktemp)
+trap 'rm -f "$manifiesto"' EXIT
+lote_ok=1
+for s in 1 2 3; do
+    echo "-i test_small.graph --seed $s" >> "$manifiesto"
+done
+echo "-i test_star.graph --seed 4 --pop_size 20" >> "$manifiesto"
+salida_lote=$($GA --batch "$manifiesto" --jobs 2 -t 60 --max_gens 30 | grep -v '^#')
+t=0
+while read -r linea; do
+    [[ -z "$linea" || "$linea" == \#* ]] && continue
+    esperado=$($GA $linea -t 60 --max_gens 30 | tail -1 | sed -E 's/Calidad: ([0-9]+).*/\1/')
+    obtenido=$(echo "$salida_lote" | awk -F'\t' -v t=$t '$1 == t { print $4 }')
+    if [ "$esperado" != "$obtenido" ]; then
+        echo -e "${RED}✗ FAIL${NC} - trabajo $t: lote=$obtenido, suelta=$esperado"
+        lote_ok=0
+    fi
+    t=$((t + 1))
+done < "$manifiesto"
+if [ "$lote_ok" -eq 1 ]; then
+    echo -e "${GREEN}✓ PASS${NC} - $t corridas iguales a las corridas sueltas"
+fi
+
+# Las opciones que escriben archivos o anidan modos se rechazan por línea
+echo -e "${BLUE}Test: Lote rechaza --stats y --batch anidado${NC}"
+printf -- '-i test_small.graph --stats /dev/null\n-i test_small.graph --batch x\n' > "$manifiesto"
+rechazos=$($GA --batch "$manifiesto" -t 60 --max_gens 5 | grep -c 'ERROR.*no válida en un manifiesto')
+if [ "$rechazos" -eq 2 ]; then
+    echo -e "${GREEN}✓ PASS${NC} - 2 líneas rechazadas"
+else
+    echo -e "${RED}✗ FAIL${NC} - $rechazos de 2 líneas rechazadas"
+fi
+
+echo ""
+echo "=== MODO SERVIDOR (--serve) ==="
+echo ""
+
+echo -e "${BLUE}Test: Servidor vs corrida suelta${NC}"
+if [ -x ../tools/ga_cliente ]; then
+    socket_ga=$(mktemp -u /tmp/ga_test.XXXXXX.sock)
+    $GA --serve "$socket_ga" --jobs 2 2>/dev/null &
+    pid_servidor=$!
+    for _ in $(seq 50); do [ -S "$socket_ga" ] && break; sleep 0.1; done
+
+    esperado=$($GA -i test_small.graph -t 60 --seed 7 --max_gens 30 | tail -1 | sed -E 's/,.*//')
+    obtenido=$(../tools/ga_cliente -s "$socket_ga" -i test_small.graph -t 60 --seed 7 --max_gens 30 | tail -1 | sed -E 's/,.*//')
+    costo=$(../tools/ga_cliente -s "$socket_ga" -t 60 --max_gens 30 --irace 1 1 7 test_small.graph)
+    rechazo=$(../tools/ga_cliente -s "$socket_ga" -i test_small.graph --resume /dev/null 2>&1)
+    kill -TERM "$pid_servidor"
+    wait "$pid_servidor"
+
+    if [ -n "$esperado" ] && [ "$esperado" == "$obtenido" ] && [ "$costo" == "-${esperado#Calidad: }" ]; then
+        echo -e "${GREEN}✓ PASS${NC} - $obtenido (costo irace: $costo)"
+    else
+        echo -e "${RED}✗ FAIL${NC} - suelta='$esperado', servidor='$obtenido', irace='$costo'"
+    fi
+    if [[ "$rechazo" == "ERROR: opción --resume no válida en un pedido" ]]; then
+        echo -e "${GREEN}✓ PASS${NC} - pedido con --resume rechazado"
+    else
+        echo -e "${RED}✗ FAIL${NC} - pedido con --resume: '$rechazo'"
+    fi
+else
+    echo -e "${BLUE}Info: ../tools/ga_cliente no existe (make tools). Saltando.${NC}"
+fi
+
 echo ""
 echo "=== EJEMPLO DE EJECUCIÓN (5 segundos) ==="
 echo ""
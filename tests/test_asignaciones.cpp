@@ -0,0 +1,79 @@
+// Verifica que el bucle generacional de MotorGA no haga asignaciones de
+// memoria una vez inicializado, contando cada llamada a operator new.
+
+#include "MotorGA.h"
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace {
+std::atomic<long long> asignaciones{0};
+}
+
+void* operator new(std::size_t tam) {
+    asignaciones.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(tam ? tam : 1)) return p;
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t tam) {
+    return operator new(tam);
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+
+namespace {
+
+Grafo grafoAleatorio(int n, int m, uint64_t semilla) {
+    Rng gen(Rng::Tipo::XOSHIRO256, semilla);
+    std::vector<std::pair<int, int>> aristas;
+    for (int e = 0; e < m; ++e) {
+        aristas.emplace_back(gen() % n, gen() % n);
+    }
+    Grafo grafo;
+    grafo.construirDesdeAristas(n, aristas);
+    return grafo;
+}
+
+bool probar(const Grafo& grafo, int pop_size, int num_hilos, bool busqueda_local) {
+    ParametrosGA params;
+    params.pop_size = pop_size;
+    params.seeding_rate = 0.2;
+    params.p_mut = 0.05;
+    params.busqueda_local = busqueda_local;
+
+    MotorGA motor(grafo, params, pop_size, 42, num_hilos);
+    motor.inicializar();
+    for (int g = 0; g < 3; ++g) motor.generacion();  // calentamiento
+
+    long long antes = asignaciones.load();
+    for (int g = 0; g < 50; ++g) motor.generacion();
+    long long durante = asignaciones.load() - antes;
+
+    bool ok = (durante == 0);
+    std::cout << (ok ? "PASS" : "FAIL") << " - pop_size " << pop_size
+              << ", hilos " << num_hilos << (busqueda_local ? ", búsqueda local" : "")
+              << ": " << durante
+              << " asignaciones en 50 generaciones" << std::endl;
+    return ok;
+}
+
+} // namespace
+
+int main() {
+    Grafo grafo = grafoAleatorio(3000, 15000, 7);
+
+    bool ok = true;
+    ok = probar(grafo, 100, 1, false) && ok;
+    ok = probar(grafo, 51, 1, false) && ok;   // pop_size impar: fila de descarte
+    ok = probar(grafo, 100, 4, false) && ok;
+    ok = probar(grafo, 100, 2, true) && ok;
+
+    return ok ? 0 : 1;
+}
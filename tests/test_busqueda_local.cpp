@@ -0,0 +1,120 @@
+// Verifica la búsqueda local ARW: el resultado es un conjunto independiente
+// con el fitness correcto, maximal y sin (1,2)-swaps disponibles, y sigue
+// siendo válido cuando el presupuesto se agota a mitad de camino; y un
+// 1-swap habilita una mejora que los (1,2)-swaps solos no ven.
+
+#include "BusquedaLocal.h"
+#include "Operadores.h"
+#include "comun.h"
+#include <iostream>
+#include <utility>
+#include <vector>
+
+using namespace prueba;
+
+namespace {
+
+bool activo(const std::vector<uint64_t>& w, int v) {
+    return (w[v >> 6] >> (v & 63)) & 1ULL;
+}
+
+// Independiente, con 'fitness' nodos; si 'optimo_local', además sin
+// vértices libres ni (1,2)-swaps
+bool verificar(const Grafo& grafo, const std::vector<uint64_t>& w, int fitness, bool optimo_local) {
+    int cuenta = 0;
+    for (int u = 0; u < grafo.n; ++u) {
+        if (!activo(w, u)) continue;
+        cuenta++;
+        for (int v : grafo.vecinosDe(u)) {
+            if (activo(w, v)) return false;
+        }
+    }
+    if (cuenta != fitness) return false;
+    if (!optimo_local) return true;
+
+    std::vector<int> tight(grafo.n, 0);
+    for (int u = 0; u < grafo.n; ++u) {
+        if (!activo(w, u)) continue;
+        for (int v : grafo.vecinosDe(u)) tight[v]++;
+    }
+    for (int v = 0; v < grafo.n; ++v) {
+        if (!activo(w, v) && tight[v] == 0) return false;
+    }
+    for (int x = 0; x < grafo.n; ++x) {
+        if (!activo(w, x)) continue;
+        std::vector<int> uno;
+        for (int y : grafo.vecinosDe(x)) {
+            if (tight[y] == 1) uno.push_back(y);
+        }
+        for (size_t i = 0; i < uno.size(); ++i) {
+            for (size_t j = i + 1; j < uno.size(); ++j) {
+                if (!grafo.sonAdyacentes(uno[i], uno[j])) return false;
+            }
+        }
+    }
+    return true;
+}
+
+bool probar(int n, double grado_medio, uint64_t semilla) {
+    Grafo grafo = grafoAleatorio(n, grado_medio, semilla);
+    Rng gen(Rng::Tipo::XOSHIRO256, semilla + 100);
+    size_t num_palabras = (n + 63) / 64;
+    BusquedaLocal bl(grafo);
+
+    int fallos = 0, casos = 0, mejoras = 0;
+    for (int caso = 0; caso < 50; ++caso) {
+        std::vector<uint64_t> w(num_palabras);
+        for (uint64_t& x : w) x = gen();
+        if (n & 63) w.back() &= (1ULL << (n & 63)) - 1;
+        int fitness = Operadores::reparar(w.data(), num_palabras, grafo);
+
+        // Presupuesto ilimitado: óptimo local
+        std::vector<uint64_t> completo = w;
+        long long presupuesto = 1LL << 60;
+        int f = bl.mejorar(completo.data(), fitness, presupuesto);
+        casos++;
+        if (f < fitness || !verificar(grafo, completo, f, true)) fallos++;
+        if (f > fitness) mejoras++;
+
+        // Presupuesto corto: válido aunque no sea óptimo local
+        std::vector<uint64_t> parcial = w;
+        presupuesto = n + caso * 7;
+        f = bl.mejorar(parcial.data(), fitness, presupuesto);
+        casos++;
+        if (f < fitness || !verificar(grafo, parcial, f, false)) fallos++;
+    }
+
+    bool ok = (fallos == 0 && mejoras > 0);
+    std::cout << (ok ? "PASS" : "FAIL") << " - n " << n << ", grado medio " << grado_medio
+              << ": " << fallos << "/" << casos << " resultados inválidos, "
+              << mejoras << " soluciones mejoradas" << std::endl;
+    return ok;
+}
+
+// {x, z} es maximal y sin (1,2)-swaps; el 1-swap x -> u deja a p y q
+// 1-tight con z, y el (1,2)-swap z -> p, q llega al óptimo {u, p, q}
+bool probarUnoSwap() {
+    const int x = 0, z = 1, u = 2, p = 3, q = 4;
+    std::vector<std::pair<int, int>> aristas = {{x, u}, {x, p}, {x, q}, {z, p}, {z, q}};
+    Grafo grafo;
+    grafo.construirDesdeAristas(5, aristas);
+    std::vector<uint64_t> w = {(1ULL << x) | (1ULL << z)};
+    BusquedaLocal bl(grafo);
+    long long presupuesto = 1LL << 60;
+    int f = bl.mejorar(w.data(), 2, presupuesto);
+    bool ok = f == 3 && w[0] == ((1ULL << u) | (1ULL << p) | (1ULL << q));
+    std::cout << (ok ? "PASS" : "FAIL") << " - 1-swap habilita un (1,2)-swap: tamaño 2 -> "
+              << f << std::endl;
+    return ok;
+}
+
+} // namespace
+
+int main() {
+    bool ok = probarUnoSwap();
+    ok = probar(50, 3.0, 1) && ok;
+    ok = probar(1000, 8.0, 2) && ok;
+    ok = probar(3000, 30.0, 3) && ok;
+    ok = probar(400, 120.0, 4) && ok;
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,137 @@
+// Verifica la cache de evaluaciones (--eval_cache): cruzar() y mutar() con
+// hash producen los mismos hijos y consumen los mismos números que sin hash,
+// y el hash que mantienen es el Zobrist completo; la cache solo acierta con
+// el cromosoma exacto; y un motor con cache termina en el mismo estado que
+// uno sin cache con la misma semilla.
+
+#include "CacheEvaluaciones.h"
+#include "MotorGA.h"
+#include "Operadores.h"
+#include "Zobrist.h"
+#include "comun.h"
+#include <iostream>
+#include <utility>
+#include <vector>
+
+using namespace prueba;
+
+namespace {
+
+std::vector<uint64_t> aleatorio(int n, Rng& gen) {
+    size_t np = (n + 63) / 64;
+    std::vector<uint64_t> w(np);
+    for (size_t p = 0; p < np; ++p) w[p] = gen();
+    if (n & 63) w[np - 1] &= (1ULL << (n & 63)) - 1;
+    return w;
+}
+
+bool probarOperadores(int n, double p_cruce, double p_mut) {
+    size_t np = (n + 63) / 64;
+    Rng datos(Rng::Tipo::XOSHIRO256, 3);
+    int fallos = 0;
+    for (int caso = 0; caso < 200; ++caso) {
+        std::vector<uint64_t> p1 = aleatorio(n, datos), p2 = aleatorio(n, datos);
+        std::vector<uint64_t> a1(np), a2(np), b1(np), b2(np);
+        Rng gen_a(Rng::Tipo::XOSHIRO256, caso), gen_b(Rng::Tipo::XOSHIRO256, caso);
+
+        Operadores::cruzar(p1.data(), p2.data(), a1.data(), a2.data(), np, p_cruce, gen_a);
+        Operadores::mutar(a1.data(), n, p_mut, gen_a);
+        Operadores::mutar(a2.data(), n, p_mut, gen_a);
+
+        uint64_t hash1 = Zobrist::hash(p1.data(), np), hash2 = Zobrist::hash(p2.data(), np);
+        Operadores::cruzar(p1.data(), p2.data(), b1.data(), b2.data(), np, p_cruce, gen_b, hash1, hash2);
+        Operadores::mutar(b1.data(), n, p_mut, gen_b, hash1);
+        Operadores::mutar(b2.data(), n, p_mut, gen_b, hash2);
+
+        if (a1 != b1 || a2 != b2 || gen_a() != gen_b() ||
+            hash1 != Zobrist::hash(b1.data(), np) || hash2 != Zobrist::hash(b2.data(), np)) {
+            fallos++;
+        }
+    }
+    bool ok = (fallos == 0);
+    std::cout << (ok ? "PASS" : "FAIL") << " - cruzar/mutar con hash, n " << n << ", p_cruce "
+              << p_cruce << ", p_mut " << p_mut << ": " << fallos << "/200 distintos" << std::endl;
+    return ok;
+}
+
+bool probarCache() {
+    const int n = 300;
+    size_t np = (n + 63) / 64;
+    Grafo grafo = grafoAleatorio(n, 5.0, 4);
+    Rng datos(Rng::Tipo::XOSHIRO256, 5);
+    CacheEvaluaciones cache(1000, np);
+
+    std::vector<uint64_t> original = aleatorio(n, datos), reparado = original;
+    int fitness = Operadores::reparar(reparado.data(), np, grafo);
+    uint64_t clave = Zobrist::hash(original.data(), np);
+    uint64_t hash_reparado = Zobrist::hash(reparado.data(), np);
+    cache.insertar(clave, original.data(), reparado.data(), fitness, hash_reparado);
+
+    // Mismo cromosoma: acierto con la reparación guardada
+    std::vector<uint64_t> w = original;
+    int f = -1;
+    uint64_t h = 0;
+    bool ok = cache.capacidad() == 512 && cache.buscar(clave, w.data(), f, h) &&
+              w == reparado && f == fitness && h == hash_reparado;
+
+    // Misma clave con otros genes (colisión): fallo y w intacto
+    std::vector<uint64_t> otro = original;
+    otro[0] ^= 1;
+    w = otro;
+    ok = ok && !cache.buscar(clave, w.data(), f, h) && w == otro;
+
+    // Clave ausente
+    ok = ok && !cache.buscar(clave + 1, w.data(), f, h);
+    std::cout << (ok ? "PASS" : "FAIL") << " - cache: acierto exacto, colisión y ausencia" << std::endl;
+    return ok;
+}
+
+bool probarMotor(int hilos, double p_mut, bool busqueda_local) {
+    Grafo grafo = grafoAleatorio(600, 8.0, 6);
+    ParametrosGA params;
+    params.pop_size = 61;
+    params.p_mut = p_mut;
+    params.busqueda_local = busqueda_local;
+    const int generaciones = 60;
+    const uint64_t semilla = 77;
+
+    MotorGA sin_cache(grafo, params, params.pop_size, semilla, hilos);
+    sin_cache.inicializar();
+    for (int g = 0; g < generaciones; ++g) sin_cache.generacion();
+    EstadoGA esperado;
+    sin_cache.guardarEstado(esperado);
+
+    params.cache_evaluaciones = 4096;
+    MotorGA con_cache(grafo, params, params.pop_size, semilla, hilos);
+    con_cache.inicializar();
+    for (int g = 0; g < generaciones; ++g) con_cache.generacion();
+    EstadoGA obtenido;
+    con_cache.guardarEstado(obtenido);
+    EstadisticasCache stats = con_cache.estadisticasCache();
+
+    // Con mutación baja la población converge y los hijos se repiten
+    bool ok = mismoEstado(esperado, obtenido) &&
+              (p_mut > 0.001 || stats.aciertos + stats.aciertos_padre > 0);
+    std::cout << (ok ? "PASS" : "FAIL") << " - motor, hilos " << hilos << ", p_mut " << p_mut
+              << (busqueda_local ? ", búsqueda local" : "") << ": estado "
+              << (mismoEstado(esperado, obtenido) ? "idéntico" : "distinto") << " con cache ("
+              << stats.aciertos_padre << " copias de un padre, " << stats.aciertos
+              << " aciertos, " << stats.pausadas << " pausadas)" << std::endl;
+    return ok;
+}
+
+} // namespace
+
+int main() {
+    bool ok = true;
+    ok = probarOperadores(64, 0.9, 0.01) && ok;
+    ok = probarOperadores(1000, 0.9, 0.001) && ok;
+    ok = probarOperadores(1000, 0.0, 0.05) && ok;
+    ok = probarOperadores(3001, 0.5, 0.0) && ok;
+    ok = probarCache() && ok;
+    ok = probarMotor(1, 0.0003, false) && ok;
+    ok = probarMotor(3, 0.0003, false) && ok;
+    ok = probarMotor(2, 0.02, false) && ok;
+    ok = probarMotor(3, 0.0003, true) && ok;
+    return ok ? 0 : 1;
+}
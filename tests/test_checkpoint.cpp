@@ -0,0 +1,166 @@
+// Verifica que un checkpoint continúa la corrida exactamente: un motor que
+// corre G1 generaciones, se guarda a disco (con EscritorCheckpoint), y un
+// motor nuevo que lo restaura y corre G2 más termina con la misma
+// población, fitness y contadores que un motor que corrió G1 + G2 seguidas.
+// También que reanudar con otros parámetros de identificación falla, y que
+// un encabezado dañado se rechaza sin reservar lo que declara.
+
+#include "Checkpoint.h"
+#include "MotorGA.h"
+#include "comun.h"
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace prueba;
+
+namespace {
+
+bool probar(Rng::Tipo tipo, int hilos, bool busqueda_local) {
+    Grafo grafo = grafoAleatorio(500, 6.0, 7);
+    ParametrosGA params;
+    params.pop_size = 41;
+    params.p_mut = 0.02;
+    params.rng = tipo;
+    params.busqueda_local = busqueda_local;
+    const int g1 = 15, g2 = 20;
+    const uint64_t semilla = 1234;
+    std::string ruta = "test_checkpoint.tmp";
+
+    // Corrida de referencia, sin interrupción
+    MotorGA seguido(grafo, params, params.pop_size, semilla, hilos);
+    seguido.inicializar();
+    for (int g = 0; g < g1 + g2; ++g) seguido.generacion();
+    EstadoGA esperado;
+    seguido.guardarEstado(esperado);
+
+    // Corrida interrumpida y reanudada desde el archivo
+    bool escrito;
+    {
+        MotorGA primero(grafo, params, params.pop_size, semilla, hilos);
+        primero.inicializar();
+        for (int g = 0; g < g1; ++g) primero.generacion();
+        EscritorCheckpoint escritor(ruta);
+        EstadoGA& estado = escritor.instantanea();
+        primero.guardarEstado(estado);
+        const uint64_t* mejor = primero.poblacion().cromosoma(primero.poblacion().indiceMejor());
+        estado.mejor.assign(mejor, mejor + estado.num_palabras);
+        escritor.publicar();
+        escrito = escritor.esperar();
+    }
+    EstadoGA leido;
+    std::string error;
+    bool ok = escrito && Checkpoint::leer(ruta, leido, error);
+    std::remove(ruta.c_str());
+
+    EstadoGA obtenido;
+    if (ok) {
+        // Otra semilla: todo el estado aleatorio debe venir del checkpoint
+        MotorGA segundo(grafo, params, params.pop_size, semilla + 1, hilos);
+        ok = segundo.restaurarEstado(leido, error);
+        if (ok) {
+            for (int g = 0; g < g2; ++g) segundo.generacion();
+            segundo.guardarEstado(obtenido);
+            ok = mismoEstado(esperado, obtenido);
+        }
+    }
+
+    std::cout << (ok ? "PASS" : "FAIL") << " - " << Rng::nombreTipo(tipo) << ", hilos " << hilos
+              << (busqueda_local ? ", búsqueda local" : "") << ": "
+              << (error.empty() ? (ok ? "estado idéntico tras reanudar" : "el estado difiere")
+                                : error)
+              << std::endl;
+    return ok;
+}
+
+// Guarda a disco un motor con 'params' e intenta reanudarlo con 'otros':
+// debe fallar con un mensaje
+bool probarRechazo(const char* que, const ParametrosGA& params, const ParametrosGA& otros) {
+    Grafo grafo = grafoAleatorio(200, 6.0, 3);
+    std::string ruta = "test_checkpoint_rechazo.tmp";
+    bool escrito;
+    {
+        MotorGA primero(grafo, params, params.pop_size, 99, 1);
+        primero.inicializar();
+        primero.generacion();
+        EscritorCheckpoint escritor(ruta);
+        EstadoGA& estado = escritor.instantanea();
+        primero.guardarEstado(estado);
+        const uint64_t* mejor = primero.poblacion().cromosoma(primero.poblacion().indiceMejor());
+        estado.mejor.assign(mejor, mejor + estado.num_palabras);
+        escritor.publicar();
+        escrito = escritor.esperar();
+    }
+    EstadoGA leido;
+    std::string error;
+    bool ok = escrito && Checkpoint::leer(ruta, leido, error);
+    std::remove(ruta.c_str());
+    if (ok) {
+        MotorGA segundo(grafo, otros, otros.pop_size, 99, 1);
+        ok = !segundo.restaurarEstado(leido, error) && !error.empty();
+    }
+    std::cout << (ok ? "PASS" : "FAIL") << " - reanudar con otro " << que << ": "
+              << (error.empty() ? "aceptado" : error) << std::endl;
+    return ok;
+}
+
+// Reescribe el int64 en 'desplazamiento' de un checkpoint válido (40 =
+// pop_size, 48 = num_hilos en EncabezadoCheckpoint) y lo lee
+bool probarDanado(const char* que, long desplazamiento, int64_t valor) {
+    Grafo grafo = grafoAleatorio(200, 6.0, 3);
+    ParametrosGA params;
+    params.pop_size = 20;
+    MotorGA motor(grafo, params, params.pop_size, 99, 1);
+    motor.inicializar();
+    EstadoGA estado;
+    motor.guardarEstado(estado);
+    const uint64_t* mejor = motor.poblacion().cromosoma(motor.poblacion().indiceMejor());
+    estado.mejor.assign(mejor, mejor + estado.num_palabras);
+
+    std::string ruta = "test_checkpoint_danado.tmp";
+    bool ok = Checkpoint::escribir(ruta, estado);
+    FILE* f = std::fopen(ruta.c_str(), "r+b");
+    ok = ok && f && std::fseek(f, desplazamiento, SEEK_SET) == 0
+            && std::fwrite(&valor, sizeof(valor), 1, f) == 1;
+    if (f) std::fclose(f);
+
+    EstadoGA leido;
+    std::string error;
+    ok = ok && !Checkpoint::leer(ruta, leido, error) && error.find("dañado") != std::string::npos
+            && leido.cromosomas.empty();
+    std::remove(ruta.c_str());
+    std::cout << (ok ? "PASS" : "FAIL") << " - encabezado con " << que << ": "
+              << (error.empty() ? "aceptado" : error) << std::endl;
+    return ok;
+}
+
+} // namespace
+
+int main() {
+    bool ok = true;
+    ok = probar(Rng::Tipo::MT19937_64, 1, false) && ok;
+    ok = probar(Rng::Tipo::XOSHIRO256, 1, false) && ok;
+    ok = probar(Rng::Tipo::MT19937_64, 3, true) && ok;
+    ok = probar(Rng::Tipo::XOSHIRO256, 2, true) && ok;
+    ok = probar(Rng::Tipo::PHILOX4X32, 3, false) && ok;
+
+    ParametrosGA params;
+    params.pop_size = 20;
+    params.seed = 3;
+    ParametrosGA otro_orden = params;
+    params.orden = OrdenVertices::GRADO;
+    ok = probarRechazo("--order", params, otro_orden) && ok;
+    ParametrosGA otra_semilla = params;
+    otra_semilla.seed = 4;
+    ok = probarRechazo("--seed", params, otra_semilla) && ok;
+    ParametrosGA sin_semilla = params;
+    sin_semilla.seed = -1;
+    ok = probarRechazo("--seed (sin --seed)", params, sin_semilla) && ok;
+
+    ok = probarDanado("pop_size enorme", 40, INT32_MAX - 1) && ok;
+    ok = probarDanado("num_hilos enorme", 48, INT32_MAX - 1) && ok;
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,139 @@
+// Verifica la descomposición en componentes: separar() cubre cada nodo y
+// cada arista una sola vez con subgrafos conexos, y --components devuelve
+// una solución independiente cuyo tamaño coincide con la última calidad
+// reportada (exacta cuando todas las componentes son chicas).
+
+#include "AlgoritmoGenetico.h"
+#include "Componentes.h"
+#include "comun.h"
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace prueba;
+
+namespace {
+
+// Unión disjunta de 'copias' grafos aleatorios de n nodos cada uno
+Grafo grafoUnion(int copias, int n, double grado_medio, uint64_t semilla) {
+    Rng gen(Rng::Tipo::XOSHIRO256, semilla);
+    std::vector<std::pair<int, int>> aristas;
+    long long m = static_cast<long long>(n * grado_medio / 2.0);
+    for (int c = 0; c < copias; ++c) {
+        for (long long e = 0; e < m; ++e) {
+            aristas.emplace_back(c * n + static_cast<int>(gen() % n), c * n + static_cast<int>(gen() % n));
+        }
+    }
+    Grafo grafo;
+    grafo.construirDesdeAristas(copias * n, aristas);
+    return grafo;
+}
+
+bool conexo(const Grafo& grafo) {
+    std::vector<char> visto(grafo.n, 0);
+    std::vector<int> pila = {0};
+    visto[0] = 1;
+    int alcanzados = 1;
+    while (!pila.empty()) {
+        int u = pila.back();
+        pila.pop_back();
+        for (int v : grafo.vecinosDe(u)) {
+            if (!visto[v]) {
+                visto[v] = 1;
+                alcanzados++;
+                pila.push_back(v);
+            }
+        }
+    }
+    return alcanzados == grafo.n;
+}
+
+// Valor de la última línea "Calidad..." del reporte any-time
+int ultimaCalidad(const std::string& salida) {
+    std::istringstream in(salida);
+    std::string linea;
+    int calidad = -1;
+    while (std::getline(in, linea)) {
+        size_t p = linea.find(": ");
+        if (linea.compare(0, 7, "Calidad") == 0 && p != std::string::npos) {
+            calidad = std::stoi(linea.substr(p + 2));
+        }
+    }
+    return calidad;
+}
+
+bool probarSeparar(int copias, int n, double grado_medio, uint64_t semilla) {
+    Grafo grafo = grafoUnion(copias, n, grado_medio, semilla);
+    std::vector<Componentes::Componente> componentes = Componentes::separar(grafo);
+
+    std::vector<int> cubierto(grafo.n, 0);
+    int64_t aristas = 0;
+    bool ok = !componentes.empty();
+    for (size_t c = 0; c < componentes.size(); ++c) {
+        const Componentes::Componente& comp = componentes[c];
+        if (c > 0 && comp.grafo.n > componentes[c - 1].grafo.n) ok = false;
+        if (comp.grafo.n != static_cast<int>(comp.nodos.size()) || !conexo(comp.grafo)) ok = false;
+        for (int u = 0; u < comp.grafo.n; ++u) {
+            cubierto[comp.nodos[u]]++;
+            for (int v : comp.grafo.vecinosDe(u)) {
+                if (!grafo.sonAdyacentes(comp.nodos[u], comp.nodos[v])) ok = false;
+            }
+        }
+        aristas += comp.grafo.numAristas();
+    }
+    for (int veces : cubierto) {
+        if (veces != 1) ok = false;
+    }
+    if (aristas != grafo.numAristas()) ok = false;
+
+    std::cout << (ok ? "PASS" : "FAIL") << " - separar " << copias << "x" << n
+              << " (grado " << grado_medio << "): " << componentes.size() << " componentes" << std::endl;
+    return ok;
+}
+
+bool probarResolver(const std::string& nombre, const Grafo& grafo, int esperado, bool reducir) {
+    ParametrosGA params;
+    params.componentes = true;
+    params.reducir = reducir;
+    params.max_time = 30.0;
+    params.max_generaciones = 30;
+    params.seed = 5;
+    params.num_hilos = 3;
+    std::ostringstream salida;
+    ResultadoGA resultado = AlgoritmoGenetico::resolver(grafo, params, salida);
+
+    bool ok = resultado.error.empty()
+           && independiente(grafo, resultado.mejor.cromosoma, resultado.mejor.fitness)
+           && ultimaCalidad(salida.str()) == resultado.mejor.fitness
+           && (esperado < 0 || resultado.mejor.fitness == esperado);
+    std::cout << (ok ? "PASS" : "FAIL") << " - " << nombre << ": calidad "
+              << resultado.mejor.fitness << ", " << resultado.componentes << " componentes ("
+              << resultado.componentes_exactas << " exactas)" << std::endl;
+    return ok;
+}
+
+} // namespace
+
+int main() {
+    bool ok = true;
+    ok = probarSeparar(50, 30, 1.5, 1) && ok;
+    ok = probarSeparar(4, 2000, 3.0, 2) && ok;
+    ok = probarSeparar(1, 3000, 0.8, 3) && ok;
+
+    // Solo componentes chicas: la suma de los óptimos
+    Grafo chicas = grafoUnion(60, 25, 3.0, 4);
+    int alfa = 0;
+    for (const Componentes::Componente& comp : Componentes::separar(chicas)) {
+        uint64_t solucion;
+        alfa += Componentes::resolverExacto(comp.grafo, solucion);
+    }
+    ok = probarResolver("componentes chicas", chicas, alfa, false) && ok;
+
+    // Mezcla de grandes (GA en paralelo) y chicas, con y sin kernelización
+    Grafo mezcla = grafoUnion(5, 600, 4.0, 5);
+    ok = probarResolver("componentes grandes", mezcla, -1, false) && ok;
+    ok = probarResolver("componentes del kernel", mezcla, -1, true) && ok;
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,142 @@
+// Verifica las medidas de diversidad (clones = 0, conjuntos disjuntos = 1,
+// muestreo cerca del promedio exacto), que reiniciar() conserve la élite y
+// deje filas válidas, y que una corrida con reinicios por diversidad los
+// reporte, repita calidades y reinicios con --seed y --max_gens y termine
+// con una solución válida.
+
+#include "AlgoritmoGenetico.h"
+#include "Diversidad.h"
+#include "MotorGA.h"
+#include "comun.h"
+#include <algorithm>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace prueba;
+
+namespace {
+
+// Fila i con los genes {b·k, ..., b·k + k - 1} en 1 (bloques disjuntos)
+void cargarBloque(Poblacion& poblacion, int i, int b, int k) {
+    uint64_t* w = poblacion.cromosoma(i);
+    std::fill(w, w + poblacion.numPalabras(), 0ULL);
+    for (int u = b * k; u < (b + 1) * k; ++u) w[u >> 6] |= 1ULL << (u & 63);
+    poblacion.fitness(i) = k;
+}
+
+bool probarMedidas() {
+    const int pop_size = 40, k = 25;
+    Poblacion poblacion(pop_size, pop_size * k);
+    for (int i = 0; i < pop_size; ++i) cargarBloque(poblacion, i, i, k);
+    MedidaDiversidad disjuntas = Diversidad::medir(poblacion, 3);
+
+    for (int i = 1; i < pop_size; ++i) poblacion.copiarDesde(i, poblacion, 0);
+    MedidaDiversidad clones = Diversidad::medir(poblacion, 3);
+
+    // Mitad de una forma, mitad de otra: el promedio exacto sobre pares
+    // distintos es 20·20 / C(40, 2) ≈ 0.513
+    for (int i = 0; i < pop_size; ++i) cargarBloque(poblacion, i, i % 2, k);
+    double suma = 0.0;
+    for (long long g = 0; g < 200; ++g) suma += Diversidad::medir(poblacion, g).distancia;
+    double media = suma / 200;
+
+    bool ok = disjuntas.distancia == 1.0 && disjuntas.convergencia == 0.0 &&
+              clones.distancia == 0.0 && clones.convergencia == 1.0 &&
+              media > 0.46 && media < 0.56;
+    std::cout << (ok ? "PASS" : "FAIL") << " - medidas: disjuntas " << disjuntas.distancia
+              << ", clones " << clones.distancia << " (convergencia " << clones.convergencia
+              << "), dos grupos " << media << std::endl;
+    return ok;
+}
+
+bool probarReiniciar(int hilos) {
+    Grafo grafo = grafoAleatorio(700, 6.0, 2);
+    ParametrosGA params;
+    params.pop_size = 50;
+    params.p_mut = 0.0;
+    MotorGA motor(grafo, params, params.pop_size, 11, hilos);
+    motor.inicializar();
+    for (int g = 0; g < 80; ++g) motor.generacion();
+
+    Poblacion& poblacion = motor.poblacion();
+    std::vector<int> fitness = poblacion.fitnesses();
+    std::sort(fitness.rbegin(), fitness.rend());
+    double antes = Diversidad::medir(poblacion, motor.generaciones()).distancia;
+    long long evaluaciones = motor.evaluaciones();
+
+    const int elite = 3;
+    motor.reiniciar(elite);
+    double despues = Diversidad::medir(poblacion, motor.generaciones()).distancia;
+
+    bool ok = motor.evaluaciones() == evaluaciones + params.pop_size - elite && despues > antes;
+    for (int k = 0; k < elite; ++k) ok = ok && poblacion.fitness(k) == fitness[k];
+    for (int i = 0; i < poblacion.tamano(); ++i) {
+        ok = ok && valida(grafo, poblacion.cromosoma(i), poblacion.fitness(i));
+    }
+    std::cout << (ok ? "PASS" : "FAIL") << " - reiniciar, hilos " << hilos << ": élite "
+              << fitness[0] << " conservada, diversidad " << antes << " -> " << despues << std::endl;
+    return ok;
+}
+
+int contarLineas(const std::string& salida, const std::string& prefijo) {
+    std::istringstream in(salida);
+    std::string linea;
+    int cuenta = 0;
+    while (std::getline(in, linea)) {
+        if (linea.compare(0, prefijo.size(), prefijo) == 0) cuenta++;
+    }
+    return cuenta;
+}
+
+// Reporte any-time sin los tiempos
+std::string sinTiempos(const std::string& salida) {
+    std::istringstream in(salida);
+    std::string linea, r;
+    while (std::getline(in, linea)) r += linea.substr(0, linea.find(", Tiempo")) + "\n";
+    return r;
+}
+
+bool probarResolver(int islas) {
+    Grafo grafo = grafoAleatorio(600, 10.0, 3);
+    ParametrosGA params;
+    params.pop_size = 40;
+    params.p_mut = 0.0;
+    params.num_islas = islas;
+    params.reinicio_diversidad = 0.05;
+    params.max_time = 30.0;
+    params.max_generaciones = 300;
+    params.seed = 4;
+
+    std::ostringstream salida1, salida2;
+    ResultadoGA r1 = AlgoritmoGenetico::resolver(grafo, params, salida1);
+    ResultadoGA r2 = AlgoritmoGenetico::resolver(grafo, params, salida2);
+
+    const Cromosoma& c = r1.mejor.cromosoma;
+    int reportados = contarLineas(salida1.str(), "Reinicio (");
+    bool ok = r1.diversidad.reinicios > 0 && reportados == r1.diversidad.reinicios &&
+              r1.diversidad.mediciones > 0 && valida(grafo, c.datos(), r1.mejor.fitness);
+    // Con islas el orden entre hilos cambia las líneas; una isla es determinista
+    if (islas == 1) {
+        ok = ok && sinTiempos(salida1.str()) == sinTiempos(salida2.str()) && r1.mejor.fitness == r2.mejor.fitness &&
+             r1.evaluaciones == r2.evaluaciones;
+    }
+    std::cout << (ok ? "PASS" : "FAIL") << " - resolver, islas " << islas << ": "
+              << r1.diversidad.reinicios << " reinicios (" << reportados << " reportados), calidad "
+              << r1.mejor.fitness << std::endl;
+    return ok;
+}
+
+} // namespace
+
+int main() {
+    bool ok = true;
+    ok = probarMedidas() && ok;
+    ok = probarReiniciar(1) && ok;
+    ok = probarReiniciar(3) && ok;
+    ok = probarResolver(1) && ok;
+    ok = probarResolver(2) && ok;
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,160 @@
+// Verifica el modelo estacionario (--model steady): MonticuloPoblacion da
+// el mismo mejor y peor que recorrer la población tras miles de cambios; el
+// motor deja filas válidas, nunca pierde al mejor, avisa cada mejora al
+// insertarla, repite el estado con la misma semilla, con y sin cache y al
+// reanudar desde un estado guardado; y resolver() con islas termina con una
+// solución válida.
+
+#include "AlgoritmoGenetico.h"
+#include "MonticuloPoblacion.h"
+#include "MotorGA.h"
+#include "comun.h"
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+using namespace prueba;
+
+namespace {
+
+bool probarMonticulo(int tam, int rango) {
+    Poblacion poblacion(tam, 64);
+    Rng gen(Rng::Tipo::XOSHIRO256, static_cast<uint64_t>(tam));
+    for (int i = 0; i < tam; ++i) poblacion.fitness(i) = static_cast<int>(gen.acotado(rango));
+    MonticuloPoblacion monticulo;
+    monticulo.construir(poblacion);
+
+    int fallos = 0;
+    for (int paso = 0; paso < 5000; ++paso) {
+        // Pocos valores distintos: muchos empates
+        int i = static_cast<int>(gen.acotado(tam));
+        poblacion.fitness(i) = static_cast<int>(gen.acotado(rango));
+        monticulo.actualizar(i);
+        fallos += monticulo.mejor() != poblacion.indiceMejor();
+        fallos += monticulo.peor() != poblacion.indicePeor();
+    }
+    bool ok = (fallos == 0);
+    std::cout << (ok ? "PASS" : "FAIL") << " - montículo, pop " << tam << ", fitness < " << rango
+              << ": " << fallos << " diferencias con el recorrido" << std::endl;
+    return ok;
+}
+
+MotorGA* nuevoMotor(const Grafo& grafo, ParametrosGA params, int hilos) {
+    params.pop_size = 41;
+    params.seeding_rate = 0.0;  // sin greedy el mejor inicial se supera pronto
+    params.modelo = ModeloGA::ESTACIONARIO;
+    return new MotorGA(grafo, params, params.pop_size, 19, hilos);
+}
+
+bool probarMotor(const Grafo& grafo, int hilos, bool busqueda_local) {
+    ParametrosGA params;
+    params.busqueda_local = busqueda_local;
+    std::unique_ptr<MotorGA> motor(nuevoMotor(grafo, params, hilos));
+    motor->inicializar();
+
+    const Poblacion& poblacion = motor->poblacion();
+    int mejor = poblacion.fitness(motor->indiceMejor());
+    int avisos = 0, ultimo_aviso = mejor;
+    bool avisos_crecientes = true;
+    motor->alMejorar([&](int fila) {
+        avisos++;
+        avisos_crecientes = avisos_crecientes && poblacion.fitness(fila) > ultimo_aviso;
+        ultimo_aviso = poblacion.fitness(fila);
+    });
+
+    bool ok = true;
+    for (int g = 0; g < 40; ++g) {
+        motor->generacion();
+        int ahora = poblacion.fitness(motor->indiceMejor());
+        ok = ok && ahora >= mejor && motor->indiceMejor() == poblacion.indiceMejor() &&
+             motor->indicePeor() == poblacion.indicePeor();
+        mejor = ahora;
+    }
+    for (int i = 0; i < poblacion.tamano(); ++i) {
+        ok = ok && valida(grafo, poblacion.cromosoma(i), poblacion.fitness(i));
+    }
+    ok = ok && avisos > 0 && avisos_crecientes && ultimo_aviso == mejor && motor->generaciones() == 40;
+
+    // Mismo estado con la misma semilla, y con la cache de evaluaciones
+    EstadoGA esperado, otro, con_cache;
+    motor->guardarEstado(esperado);
+    std::unique_ptr<MotorGA> repetido(nuevoMotor(grafo, params, hilos));
+    repetido->inicializar();
+    for (int g = 0; g < 40; ++g) repetido->generacion();
+    repetido->guardarEstado(otro);
+    params.cache_evaluaciones = 1024;
+    std::unique_ptr<MotorGA> cacheado(nuevoMotor(grafo, params, hilos));
+    cacheado->inicializar();
+    for (int g = 0; g < 40; ++g) cacheado->generacion();
+    cacheado->guardarEstado(con_cache);
+    ok = ok && mismoEstado(esperado, otro) && mismoEstado(esperado, con_cache);
+
+    std::cout << (ok ? "PASS" : "FAIL") << " - motor estacionario, hilos " << hilos
+              << (busqueda_local ? ", búsqueda local" : "") << ": mejor " << mejor << ", "
+              << avisos << " mejoras avisadas, " << motor->evaluaciones() << " evaluaciones" << std::endl;
+    return ok;
+}
+
+bool probarReanudar(const Grafo& grafo, int hilos) {
+    ParametrosGA params;
+    std::unique_ptr<MotorGA> seguido(nuevoMotor(grafo, params, hilos));
+    seguido->inicializar();
+    for (int g = 0; g < 30; ++g) seguido->generacion();
+
+    std::unique_ptr<MotorGA> primero(nuevoMotor(grafo, params, hilos));
+    primero->inicializar();
+    for (int g = 0; g < 12; ++g) primero->generacion();
+    EstadoGA intermedio;
+    primero->guardarEstado(intermedio);
+
+    std::unique_ptr<MotorGA> segundo(nuevoMotor(grafo, params, hilos));
+    std::string error;
+    bool ok = segundo->restaurarEstado(intermedio, error);
+    for (int g = 12; g < 30; ++g) segundo->generacion();
+
+    EstadoGA a, b;
+    seguido->guardarEstado(a);
+    segundo->guardarEstado(b);
+    ok = ok && mismoEstado(a, b);
+    std::cout << (ok ? "PASS" : "FAIL") << " - reanudar estacionario, hilos " << hilos
+              << ": estado " << (ok ? "idéntico" : "distinto") << std::endl;
+    return ok;
+}
+
+bool probarResolver(const Grafo& grafo, int islas) {
+    ParametrosGA params;
+    params.modelo = ModeloGA::ESTACIONARIO;
+    params.pop_size = 40;
+    params.num_islas = islas;
+    params.max_time = 30.0;
+    params.max_generaciones = 60;
+    params.seed = 2;
+    std::ostringstream salida;
+    ResultadoGA r = AlgoritmoGenetico::resolver(grafo, params, salida);
+    const Cromosoma& c = r.mejor.cromosoma;
+    bool ok = r.error.empty() && valida(grafo, c.datos(), r.mejor.fitness) && r.generaciones > 0;
+    std::cout << (ok ? "PASS" : "FAIL") << " - resolver estacionario, islas " << islas << ": calidad "
+              << r.mejor.fitness << ", " << r.generaciones << " generaciones" << std::endl;
+    return ok;
+}
+
+} // namespace
+
+int main() {
+    Grafo grafo = grafoAleatorio(500, 8.0, 7);
+    bool ok = true;
+    ok = probarMonticulo(1, 3) && ok;
+    ok = probarMonticulo(2, 2) && ok;
+    ok = probarMonticulo(37, 4) && ok;
+    ok = probarMonticulo(200, 1000) && ok;
+    ok = probarMotor(grafo, 1, false) && ok;
+    ok = probarMotor(grafo, 3, false) && ok;
+    ok = probarMotor(grafo, 2, true) && ok;
+    ok = probarReanudar(grafo, 1) && ok;
+    ok = probarReanudar(grafo, 2) && ok;
+    ok = probarResolver(grafo, 1) && ok;
+    ok = probarResolver(grafo, 2) && ok;
+    return ok ? 0 : 1;
+}
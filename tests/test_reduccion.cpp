@@ -0,0 +1,145 @@
+// Verifica la kernelización: en grafos chicos el óptimo se conserva
+// (α(G) = α(kernel) + desplazamiento, con α por fuerza bruta) y la
+// solución óptima del kernel reconstruida es un conjunto independiente
+// óptimo de G; en grafos medianos, cualquier solución del kernel se
+// reconstruye a una solución válida de tamaño + desplazamiento.
+
+#include "Operadores.h"
+#include "Reduccion.h"
+#include "comun.h"
+#include <algorithm>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+using namespace prueba;
+
+namespace {
+
+// Pares de gemelos de grado 3 (con y sin arista en la vecindad) colgados
+// de un grafo aleatorio, para ejercitar esa regla
+Grafo grafoConGemelos(int n, uint64_t semilla) {
+    Rng gen(Rng::Tipo::XOSHIRO256, semilla);
+    std::vector<std::pair<int, int>> aristas;
+    int base = n - 10;
+    for (int e = 0; e < base * 3 / 2; ++e) aristas.emplace_back(gen() % base, gen() % base);
+    for (int g = 0; g < 2; ++g) {
+        int u = base + 5 * g, v = u + 1, a = u + 2, b = u + 3, c = u + 4;
+        for (int x : {a, b, c}) {
+            aristas.emplace_back(u, x);
+            aristas.emplace_back(v, x);
+            aristas.emplace_back(x, static_cast<int>(gen() % base));
+        }
+        if (g == 1) aristas.emplace_back(a, b);
+    }
+    Grafo grafo;
+    grafo.construirDesdeAristas(n, aristas);
+    return grafo;
+}
+
+// α por ramificación: algún vértice de N[v] está en todo MIS maximal
+int mis(const std::vector<uint64_t>& cerrada, uint64_t vivos, uint64_t& mejor) {
+    if (!vivos) {
+        mejor = 0;
+        return 0;
+    }
+    int v = -1, grado_min = 65;
+    for (uint64_t r = vivos; r; r &= r - 1) {
+        int u = __builtin_ctzll(r);
+        int g = __builtin_popcountll(cerrada[u] & vivos);
+        if (g < grado_min) {
+            grado_min = g;
+            v = u;
+        }
+    }
+    int mejor_tam = -1;
+    for (uint64_t r = cerrada[v] & vivos; r; r &= r - 1) {
+        int u = __builtin_ctzll(r);
+        uint64_t sub;
+        int tam = 1 + mis(cerrada, vivos & ~cerrada[u], sub);
+        if (tam > mejor_tam) {
+            mejor_tam = tam;
+            mejor = sub | (1ULL << u);
+        }
+    }
+    return mejor_tam;
+}
+
+int misExacto(const Grafo& grafo, uint64_t& solucion) {
+    std::vector<uint64_t> cerrada(grafo.n);
+    for (int u = 0; u < grafo.n; ++u) {
+        cerrada[u] = 1ULL << u;
+        for (int v : grafo.vecinosDe(u)) cerrada[u] |= 1ULL << v;
+    }
+    uint64_t vivos = (grafo.n == 64) ? ~0ULL : (1ULL << grafo.n) - 1;
+    return mis(cerrada, vivos, solucion);
+}
+
+bool probarChicos() {
+    int fallos = 0, casos = 0;
+    long long nodos = 0, nodos_kernel = 0;
+    for (uint64_t semilla = 1; semilla <= 300; ++semilla) {
+        int n = 8 + static_cast<int>(semilla % 33);
+        double grado = 1.0 + (semilla % 7) * 0.6;
+        Grafo grafo = (semilla % 5 == 0) ? grafoConGemelos(std::max(n, 20), semilla)
+                                         : grafoAleatorio(n, grado, semilla);
+        uint64_t sol;
+        int alfa = misExacto(grafo, sol);
+
+        Reduccion red(grafo);
+        const Grafo& kernel = red.kernel();
+        uint64_t sol_kernel = 0;
+        int alfa_kernel = misExacto(kernel, sol_kernel);
+
+        Cromosoma original(grafo.n);
+        int tam = red.reconstruir(&sol_kernel, original);
+        casos++;
+        if (alfa_kernel + red.desplazamiento() != alfa || tam != alfa ||
+            !independiente(grafo, original, tam)) {
+            fallos++;
+        }
+        nodos += grafo.n;
+        nodos_kernel += kernel.n;
+    }
+    bool ok = (fallos == 0);
+    std::cout << (ok ? "PASS" : "FAIL") << " - grafos chicos: " << fallos << "/" << casos
+              << " con óptimo distinto o reconstrucción inválida (kernel: "
+              << nodos_kernel << "/" << nodos << " nodos)" << std::endl;
+    return ok;
+}
+
+bool probarMediano(int n, double grado_medio, uint64_t semilla) {
+    Grafo grafo = grafoAleatorio(n, grado_medio, semilla);
+    Reduccion red(grafo);
+    const Grafo& kernel = red.kernel();
+    Rng gen(Rng::Tipo::XOSHIRO256, semilla + 7);
+    size_t num_palabras = (kernel.n + 63) / 64;
+
+    int fallos = 0;
+    for (int caso = 0; caso < 20; ++caso) {
+        std::vector<uint64_t> w(num_palabras + 1, 0);
+        for (size_t p = 0; p < num_palabras; ++p) w[p] = gen();
+        if (kernel.n & 63) w[num_palabras - 1] &= (1ULL << (kernel.n & 63)) - 1;
+        int fitness = Operadores::reparar(w.data(), num_palabras, kernel);
+
+        Cromosoma original(grafo.n);
+        int tam = red.reconstruir(w.data(), original);
+        if (tam != fitness + red.desplazamiento() || !independiente(grafo, original, tam)) fallos++;
+    }
+    bool ok = (fallos == 0);
+    std::cout << (ok ? "PASS" : "FAIL") << " - n " << n << ", grado medio " << grado_medio
+              << ": kernel " << kernel.n << " nodos, " << fallos << "/20 reconstrucciones inválidas"
+              << std::endl;
+    return ok;
+}
+
+} // namespace
+
+int main() {
+    bool ok = true;
+    ok = probarChicos() && ok;
+    ok = probarMediano(20000, 2.5, 1) && ok;
+    ok = probarMediano(20000, 4.0, 2) && ok;
+    ok = probarMediano(5000, 12.0, 3) && ok;
+    return ok ? 0 : 1;
+}
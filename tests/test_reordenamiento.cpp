@@ -0,0 +1,125 @@
+// Verifica --order: cada política da una permutación, el grafo reordenado
+// tiene las mismas aristas con los ids nuevos, el orden por grado es no
+// decreciente, RCM acerca los vecinos de una grilla desordenada, y la
+// solución que devuelve el GA está en los ids de entrada.
+
+#include "AlgoritmoGenetico.h"
+#include "Reordenamiento.h"
+#include "comun.h"
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+using namespace prueba;
+
+namespace {
+
+// Grilla lado × lado con los ids mezclados
+Grafo grillaMezclada(int lado, uint64_t semilla) {
+    int n = lado * lado;
+    std::vector<int> id(n);
+    for (int i = 0; i < n; ++i) id[i] = i;
+    Rng gen(Rng::Tipo::XOSHIRO256, semilla);
+    for (int i = n - 1; i > 0; --i) std::swap(id[i], id[gen() % (i + 1)]);
+    std::vector<std::pair<int, int>> aristas;
+    for (int f = 0; f < lado; ++f) {
+        for (int c = 0; c < lado; ++c) {
+            if (c + 1 < lado) aristas.emplace_back(id[f * lado + c], id[f * lado + c + 1]);
+            if (f + 1 < lado) aristas.emplace_back(id[f * lado + c], id[(f + 1) * lado + c]);
+        }
+    }
+    Grafo grafo;
+    grafo.construirDesdeAristas(n, aristas);
+    return grafo;
+}
+
+int anchoBanda(const Grafo& grafo) {
+    int ancho = 0;
+    for (int u = 0; u < grafo.n; ++u) {
+        for (int v : grafo.vecinosDe(u)) ancho = std::max(ancho, std::abs(u - v));
+    }
+    return ancho;
+}
+
+bool probarPermutacion(const Grafo& grafo, OrdenVertices orden) {
+    std::vector<int> nuevo_id = Reordenamiento::permutacion(grafo, orden, 11);
+    Grafo reordenado = Reordenamiento::aplicar(grafo, nuevo_id);
+
+    std::vector<char> usado(grafo.n, 0);
+    bool ok = static_cast<int>(nuevo_id.size()) == grafo.n && reordenado.n == grafo.n &&
+              reordenado.numAristas() == grafo.numAristas() &&
+              reordenado.tieneMatrizBits() == grafo.tieneMatrizBits();
+    for (int u = 0; ok && u < grafo.n; ++u) {
+        if (nuevo_id[u] < 0 || nuevo_id[u] >= grafo.n || usado[nuevo_id[u]]) ok = false;
+        else usado[nuevo_id[u]] = 1;
+    }
+    for (int u = 0; ok && u < grafo.n; ++u) {
+        for (int v : grafo.vecinosDe(u)) {
+            if (!reordenado.sonAdyacentes(nuevo_id[u], nuevo_id[v])) ok = false;
+        }
+    }
+    if (ok && orden == OrdenVertices::GRADO) {
+        for (int i = 1; i < reordenado.n; ++i) {
+            if (reordenado.grado(i) < reordenado.grado(i - 1)) ok = false;
+        }
+    }
+    std::cout << (ok ? "PASS" : "FAIL") << " - " << Reordenamiento::nombre(orden) << ", n "
+              << grafo.n << ": permutación y aristas" << std::endl;
+    return ok;
+}
+
+bool probarBanda() {
+    Grafo grafo = grillaMezclada(60, 3);
+    int antes = anchoBanda(grafo);
+    int despues = anchoBanda(Reordenamiento::aplicar(
+        grafo, Reordenamiento::permutacion(grafo, OrdenVertices::RCM, 0)));
+    bool ok = despues <= 2 * 60;
+    std::cout << (ok ? "PASS" : "FAIL") << " - rcm en grilla 60x60 mezclada: ancho de banda "
+              << antes << " -> " << despues << std::endl;
+    return ok;
+}
+
+bool probarResolver(OrdenVertices orden) {
+    Grafo grafo = grafoAleatorio(800, 6.0, 5);
+    ParametrosGA params;
+    params.orden = orden;
+    params.max_time = 30.0;
+    params.max_generaciones = 20;
+    params.seed = 9;
+    std::ostringstream salida;
+    ResultadoGA resultado = AlgoritmoGenetico::resolver(grafo, params, salida);
+
+    const Cromosoma& c = resultado.mejor.cromosoma;
+    int cuenta = 0;
+    bool ok = true;
+    for (int u = 0; u < grafo.n; ++u) {
+        if (!c[u]) continue;
+        cuenta++;
+        for (int v : grafo.vecinosDe(u)) {
+            if (c[v]) ok = false;
+        }
+    }
+    ok = ok && cuenta == resultado.mejor.fitness;
+    std::cout << (ok ? "PASS" : "FAIL") << " - GA con --order " << Reordenamiento::nombre(orden)
+              << ": calidad " << resultado.mejor.fitness << " en ids originales" << std::endl;
+    return ok;
+}
+
+} // namespace
+
+int main() {
+    const OrdenVertices ordenes[] = {OrdenVertices::ORIGINAL, OrdenVertices::GRADO,
+                                     OrdenVertices::RCM, OrdenVertices::ALEATORIO};
+    Grafo ralo = grafoAleatorio(3000, 4.0, 1);
+    Grafo denso = grafoAleatorio(500, 60.0, 2);
+    bool ok = true;
+    for (OrdenVertices orden : ordenes) {
+        ok = probarPermutacion(ralo, orden) && ok;
+        ok = probarPermutacion(denso, orden) && ok;
+    }
+    ok = probarBanda() && ok;
+    for (OrdenVertices orden : ordenes) ok = probarResolver(orden) && ok;
+    return ok ? 0 : 1;
+}
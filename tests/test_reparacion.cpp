@@ -0,0 +1,133 @@
+// Verifica que la reparación incremental (evaluación delta) produzca el
+// mismo cromosoma y el mismo fitness que la reparación completa, y que el
+// camino denso (matriz de bits, cada núcleo SIMD) coincida con el CSR.
+
+#include "Greedy.h"
+#include "Operadores.h"
+#include "comun.h"
+#include <cstring>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+using namespace prueba;
+
+namespace {
+
+// Conjunto independiente: greedy o bits al azar reparados
+std::vector<uint64_t> padreAleatorio(const Grafo& grafo, size_t num_palabras, Rng& gen, int& fitness) {
+    std::vector<uint64_t> w(num_palabras, 0);
+    if (gen() % 4 == 0) {
+        Individuo ind = Greedy::crearIndividuo(grafo, 2, gen);
+        std::memcpy(w.data(), ind.cromosoma.datos(), num_palabras * sizeof(uint64_t));
+        fitness = ind.fitness;
+        return w;
+    }
+    for (uint64_t& x : w) x = gen();
+    if (grafo.n & 63) w.back() &= (1ULL << (grafo.n & 63)) - 1;
+    fitness = Operadores::reparar(w.data(), num_palabras, grafo);
+    return w;
+}
+
+int contarFallos(const Grafo& grafo, uint64_t semilla, int& casos) {
+    int n = grafo.n;
+    Rng gen(Rng::Tipo::XOSHIRO256, semilla * 31 + 1);
+    size_t num_palabras = (n + 63) / 64;
+    std::vector<uint64_t> pendientes(num_palabras, 0);
+    const double p_muts[] = {0.0, 0.001, 0.01, 0.2};
+    const double p_cruces[] = {0.0, 1.0};
+
+    int fallos = 0;
+    for (int caso = 0; caso < 200; ++caso) {
+        int f1, f2;
+        std::vector<uint64_t> p1 = padreAleatorio(grafo, num_palabras, gen, f1);
+        // Padres parecidos (población convergida) o independientes
+        std::vector<uint64_t> p2;
+        if (caso % 2 == 0) {
+            p2 = p1;
+            Operadores::mutar(p2.data(), n, 0.02, gen);
+            f2 = Operadores::reparar(p2.data(), num_palabras, grafo);
+        } else {
+            p2 = padreAleatorio(grafo, num_palabras, gen, f2);
+        }
+
+        std::vector<uint64_t> h1(num_palabras), h2(num_palabras);
+        Operadores::cruzar(p1.data(), p2.data(), h1.data(), h2.data(), num_palabras,
+                           p_cruces[caso % 2], gen);
+        Operadores::mutar(h1.data(), n, p_muts[caso % 4], gen);
+
+        // Referencia: reparación completa recorriendo el CSR, nodo a nodo
+        std::vector<uint64_t> esperado = h1;
+        int f_esperado = 0;
+        for (int u = 0; u < n; ++u) {
+            if (!((esperado[u >> 6] >> (u & 63)) & 1ULL)) continue;
+            bool conflicto = false;
+            for (int v : grafo.vecinosDe(u)) {
+                if (v < u && ((esperado[v >> 6] >> (v & 63)) & 1ULL)) conflicto = true;
+            }
+            if (conflicto) esperado[u >> 6] &= ~(1ULL << (u & 63));
+            else f_esperado++;
+        }
+
+        const uint64_t* refs[] = {p1.data(), p2.data()};
+        int fits[] = {f1, f2};
+        for (int r = 0; r < 4; ++r) {
+            std::vector<uint64_t> obtenido = h1;
+            int f;
+            if (r < 2) {
+                f = Operadores::repararIncremental(obtenido.data(), refs[r], fits[r],
+                                                   num_palabras, grafo, pendientes.data());
+            } else if (r == 2) {
+                f = Operadores::repararDesdePadres(obtenido.data(), p1.data(), f1, p2.data(), f2,
+                                                   num_palabras, grafo, pendientes.data());
+            } else {
+                f = Operadores::reparar(obtenido.data(), num_palabras, grafo);
+            }
+            bool limpio = true;
+            for (uint64_t x : pendientes) limpio = limpio && x == 0;
+            casos++;
+            if (f != f_esperado || obtenido != esperado || !limpio) fallos++;
+        }
+    }
+    return fallos;
+}
+
+bool probar(int n, double grado_medio, uint64_t semilla) {
+    Grafo grafo = grafoAleatorio(n, grado_medio, semilla);
+    bool ok = true;
+
+    // Camino CSR y camino denso con cada núcleo soportado por la CPU
+    const NucleoSimd nucleos[] = {NucleoSimd::ESCALAR, NucleoSimd::SSE41, NucleoSimd::AVX2};
+    NucleoSimd original = Operadores::nucleoSimd();
+    for (int modo = 0; modo < 4; ++modo) {
+        const char* nombre = "csr";
+        if (modo == 0) {
+            grafo.liberarMatrizBits();
+        } else {
+            if (!Operadores::fijarNucleoSimd(nucleos[modo - 1])) continue;
+            if (!grafo.tieneMatrizBits()) grafo.construirMatrizBits();
+            nombre = Operadores::nombreNucleo(nucleos[modo - 1]);
+        }
+
+        int casos = 0;
+        int fallos = contarFallos(grafo, semilla, casos);
+        std::cout << (fallos == 0 ? "PASS" : "FAIL") << " - n " << n << ", grado medio "
+                  << grado_medio << ", " << nombre << ": " << fallos << "/" << casos
+                  << " diferencias con la reparación completa" << std::endl;
+        ok = ok && fallos == 0;
+    }
+    Operadores::fijarNucleoSimd(original);
+    return ok;
+}
+
+} // namespace
+
+int main() {
+    bool ok = true;
+    ok = probar(1, 0.0, 1) && ok;
+    ok = probar(100, 3.0, 2) && ok;
+    ok = probar(1000, 10.0, 3) && ok;
+    ok = probar(2000, 50.0, 4) && ok;
+    ok = probar(300, 150.0, 5) && ok;   // denso
+    return ok ? 0 : 1;
+}
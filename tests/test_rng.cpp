@@ -0,0 +1,122 @@
+// Verifica la capa de números aleatorios: Philox4x32-10 contra los vectores
+// de referencia de Random123; llenar() e indices() dan los mismos números
+// que las llamadas sueltas desde cualquier punto de la secuencia;
+// guardarEstado()/cargarEstado() continúan la secuencia a mitad de bloque; y
+// los flujos de Rng::flujo() son reproducibles y distintos entre sí.
+
+#include "Rng.h"
+#include <iostream>
+#include <set>
+#include <vector>
+
+namespace {
+
+const Rng::Tipo TIPOS[] = {Rng::Tipo::MT19937_64, Rng::Tipo::XOSHIRO256, Rng::Tipo::PHILOX4X32};
+
+// Philox4x32-10 (kat_vectors de Random123): clave de 2x32 y contador de
+// 4x32; con Rng, clave = k0 | k1 << 32 y contador = (bloque, flujo)
+struct VectorPhilox {
+    uint32_t ctr[4];
+    uint32_t clave[2];
+    uint32_t esperado[4];
+};
+
+const VectorPhilox VECTORES[] = {
+    {{0, 0, 0, 0}, {0, 0}, {0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8}},
+    {{0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}, {0xffffffff, 0xffffffff},
+     {0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd}},
+    {{0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}, {0xa4093822, 0x299f31d0},
+     {0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}},
+};
+
+bool probarPhilox() {
+    int fallos = 0;
+    for (const VectorPhilox& v : VECTORES) {
+        uint64_t clave = v.clave[0] | (static_cast<uint64_t>(v.clave[1]) << 32);
+        uint64_t bloque = v.ctr[0] | (static_cast<uint64_t>(v.ctr[1]) << 32);
+        uint64_t flujo = v.ctr[2] | (static_cast<uint64_t>(v.ctr[3]) << 32);
+
+        // Se llega al bloque cargando el estado (bloque, posición 2 = agotado)
+        Rng gen(Rng::Tipo::PHILOX4X32);
+        gen.cargarEstado({clave, bloque, flujo, 2});
+        uint64_t a = gen(), b = gen();
+        if (a != (v.esperado[0] | (static_cast<uint64_t>(v.esperado[1]) << 32)) ||
+            b != (v.esperado[2] | (static_cast<uint64_t>(v.esperado[3]) << 32))) {
+            fallos++;
+        }
+    }
+    bool ok = (fallos == 0);
+    std::cout << (ok ? "PASS" : "FAIL") << " - Philox4x32-10: " << fallos
+              << "/3 vectores de referencia distintos" << std::endl;
+    return ok;
+}
+
+bool probarLlenar(Rng::Tipo tipo) {
+    int fallos = 0;
+    for (size_t previos = 0; previos < 4; ++previos) {
+        for (size_t cantidad : {0, 1, 2, 3, 15, 16, 17, 33, 100}) {
+            Rng a(tipo, 9), b(tipo, 9);
+            for (size_t i = 0; i < previos; ++i) { a(); b(); }
+            std::vector<uint64_t> suelto(cantidad), lote(cantidad);
+            for (uint64_t& x : suelto) x = a();
+            b.llenar(lote.data(), cantidad);
+            if (suelto != lote || a() != b()) fallos++;
+
+            std::vector<int> idx_suelto(cantidad), idx_lote(cantidad);
+            for (int& x : idx_suelto) x = static_cast<int>(a.acotado(37));
+            b.indices(idx_lote.data(), cantidad, 37);
+            for (int x : idx_lote) fallos += (x < 0 || x >= 37);
+            if (idx_suelto != idx_lote || a() != b()) fallos++;
+        }
+    }
+    bool ok = (fallos == 0);
+    std::cout << (ok ? "PASS" : "FAIL") << " - " << Rng::nombreTipo(tipo)
+              << ": llenar/indices iguales a llamadas sueltas (" << fallos << " fallos)" << std::endl;
+    return ok;
+}
+
+bool probarEstado(Rng::Tipo tipo) {
+    int fallos = 0;
+    for (int previos : {0, 1, 2, 5}) {
+        Rng a(tipo, 21);
+        for (int i = 0; i < previos; ++i) a();
+        std::vector<uint64_t> palabras;
+        a.guardarEstado(palabras);
+        Rng b(tipo, 0);
+        if (!b.cargarEstado(palabras)) fallos++;
+        for (int i = 0; i < 10; ++i) fallos += (a() != b());
+    }
+    bool ok = (fallos == 0);
+    std::cout << (ok ? "PASS" : "FAIL") << " - " << Rng::nombreTipo(tipo)
+              << ": guardar/cargar continúa la secuencia (" << fallos << " fallos)" << std::endl;
+    return ok;
+}
+
+bool probarFlujos(Rng::Tipo tipo) {
+    std::set<uint64_t> primeros;
+    bool ok = true;
+    for (uint64_t f = 0; f < 64; ++f) {
+        Rng a = Rng::flujo(tipo, 5, f), b = Rng::flujo(tipo, 5, f);
+        uint64_t x = a();
+        ok = ok && x == b();
+        primeros.insert(x);
+    }
+    Rng base(tipo, 5), cero = Rng::flujo(tipo, 5, 0);
+    bool flujo_cero = base() == cero();
+    ok = ok && primeros.size() == 64 && (tipo != Rng::Tipo::PHILOX4X32 || flujo_cero);
+    std::cout << (ok ? "PASS" : "FAIL") << " - " << Rng::nombreTipo(tipo) << ": " << primeros.size()
+              << "/64 flujos distintos y reproducibles" << std::endl;
+    return ok;
+}
+
+} // namespace
+
+int main() {
+    bool ok = probarPhilox();
+    for (Rng::Tipo tipo : TIPOS) {
+        ok = probarLlenar(tipo) && ok;
+        ok = probarEstado(tipo) && ok;
+        ok = probarFlujos(tipo) && ok;
+    }
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,81 @@
+// Verifica el seeding compartido: Greedy::generar con una base y un espacio
+// reutilizados da la misma solución que generarSolucion() con el mismo
+// generador, y la población inicial de MotorGA es idéntica con cualquier
+// número de hilos y está formada por conjuntos independientes válidos.
+
+#include "Greedy.h"
+#include "MotorGA.h"
+#include "comun.h"
+#include <iostream>
+#include <utility>
+#include <vector>
+
+using namespace prueba;
+
+namespace {
+
+bool probarBaseCompartida(const Grafo& grafo, int k) {
+    Greedy::Base base(grafo);
+    Greedy::Espacio espacio;
+    int distintas = 0;
+    for (uint64_t semilla = 1; semilla <= 20; ++semilla) {
+        Rng gen_a(Rng::Tipo::MT19937_64, semilla), gen_b(Rng::Tipo::MT19937_64, semilla);
+        std::vector<int> esperada = Greedy::generarSolucion(grafo, k, gen_a);
+        const std::vector<int>& obtenida = Greedy::generar(base, espacio, k, gen_b);
+        if (obtenida != esperada || gen_a() != gen_b()) distintas++;
+    }
+    bool ok = (distintas == 0);
+    std::cout << (ok ? "PASS" : "FAIL") << " - base compartida, n " << grafo.n << ", k " << k
+              << ": " << distintas << "/20 soluciones distintas" << std::endl;
+    return ok;
+}
+
+bool probarPoblacion(const Grafo& grafo, double seeding_rate) {
+    ParametrosGA params;
+    params.pop_size = 37;
+    params.seeding_rate = seeding_rate;
+    params.rng = Rng::Tipo::XOSHIRO256;
+
+    EstadoGA referencia;
+    bool ok = true;
+    for (int hilos : {1, 2, 4}) {
+        MotorGA motor(grafo, params, params.pop_size, 21, hilos);
+        motor.inicializar();
+        const Poblacion& poblacion = motor.poblacion();
+        for (int i = 0; i < poblacion.tamano(); ++i) {
+            ok = ok && valida(grafo, poblacion.cromosoma(i), poblacion.fitness(i));
+        }
+        EstadoGA estado;
+        motor.guardarEstado(estado);
+        if (hilos == 1) {
+            referencia = estado;
+        } else {
+            ok = ok && estado.cromosomas == referencia.cromosomas && estado.fitness == referencia.fitness;
+        }
+
+        // Un reinicio siembra igual con cualquier número de hilos
+        motor.reiniciar(2);
+        ok = ok && motor.evaluaciones() == 2 * params.pop_size - 2;
+        for (int i = 0; i < poblacion.tamano(); ++i) {
+            ok = ok && valida(grafo, poblacion.cromosoma(i), poblacion.fitness(i));
+        }
+    }
+    std::cout << (ok ? "PASS" : "FAIL") << " - población inicial, n " << grafo.n
+              << ", seeding_rate " << seeding_rate << ": idéntica con 1, 2 y 4 hilos" << std::endl;
+    return ok;
+}
+
+} // namespace
+
+int main() {
+    Grafo ralo = grafoAleatorio(3000, 4.0, 1);
+    Grafo denso = grafoAleatorio(400, 80.0, 2);
+    bool ok = true;
+    ok = probarBaseCompartida(ralo, 10) && ok;
+    ok = probarBaseCompartida(ralo, 1) && ok;
+    ok = probarBaseCompartida(denso, 25) && ok;
+    ok = probarPoblacion(ralo, 0.2) && ok;
+    ok = probarPoblacion(ralo, 1.0) && ok;
+    ok = probarPoblacion(denso, 0.5) && ok;
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,169 @@
+// Cliente del modo servidor de ./ga (./ga --serve <socket>).
+//
+// Dos formas de uso:
+//
+//   ./tools/ga_cliente [-s socket] <opciones de ga>
+//       Envía las opciones y copia la respuesta tal cual: la salida es la
+//       misma que la de ./ga con esas opciones, así que reemplaza a ./ga en
+//       un target-runner existente.
+//
+//   ./tools/ga_cliente [-s socket] [opciones base] --irace <id_config>
+//                      <id_instancia> <seed> <instancia> [bound] <parámetros>
+//       Convención de argumentos del targetRunner de irace: corre la
+//       instancia con esa seed y los parámetros, e imprime el costo
+//       (-calidad, irace minimiza).
+//
+// El socket por defecto es $GA_SOCKET. La ruta de -i se envía absoluta,
+// porque el servidor no comparte el directorio de trabajo del cliente.
+
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+using namespace std;
+
+namespace {
+
+void mostrarUso() {
+    cerr << "Uso: ./tools/ga_cliente [-s socket] <opciones de ga>\n"
+         << "     ./tools/ga_cliente [-s socket] [opciones base] --irace <id_config> <id_instancia>\n"
+         << "                        <seed> <instancia> [bound] <parámetros>\n"
+         << "El socket por defecto es $GA_SOCKET." << endl;
+}
+
+int conectar(const string& ruta) {
+    sockaddr_un dir{};
+    if (ruta.size() >= sizeof(dir.sun_path)) return -1;
+    dir.sun_family = AF_UNIX;
+    strcpy(dir.sun_path, ruta.c_str());
+
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0) return -1;
+    if (connect(fd, reinterpret_cast<sockaddr*>(&dir), sizeof(dir)) < 0) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+bool enviarTodo(int fd, const string& datos) {
+    size_t enviados = 0;
+    while (enviados < datos.size()) {
+        ssize_t r = send(fd, datos.data() + enviados, datos.size() - enviados, MSG_NOSIGNAL);
+        if (r <= 0) return false;
+        enviados += static_cast<size_t>(r);
+    }
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const char* env = getenv("GA_SOCKET");
+    string ruta_socket = env ? env : "";
+    vector<string> opciones;
+    bool modo_irace = false;
+
+    int i = 1;
+    for (; i < argc; ++i) {
+        string arg = argv[i];
+        if ((arg == "-s" || arg == "--socket") && i + 1 < argc) {
+            ruta_socket = argv[++i];
+        } else if (arg == "--irace") {
+            modo_irace = true;
+            ++i;
+            break;
+        } else if (arg == "-h" || arg == "--help") {
+            mostrarUso();
+            return 0;
+        } else {
+            opciones.push_back(arg);
+        }
+    }
+
+    if (modo_irace) {
+        if (argc - i < 4) {
+            mostrarUso();
+            return 1;
+        }
+        string seed = argv[i + 2];
+        string instancia = argv[i + 3];
+        i += 4;
+        // El bound (si irace usa capping) es el único argumento que no es opción
+        if (i < argc && argv[i][0] != '-') ++i;
+        opciones.push_back("-i");
+        opciones.push_back(instancia);
+        opciones.push_back("--seed");
+        opciones.push_back(seed);
+        for (; i < argc; ++i) opciones.push_back(argv[i]);
+    }
+
+    if (ruta_socket.empty()) {
+        cerr << "Error: Falta el socket (-s <socket> o $GA_SOCKET)" << endl;
+        mostrarUso();
+        return 1;
+    }
+
+    string pedido;
+    for (size_t k = 0; k < opciones.size(); ++k) {
+        string op = opciones[k];
+        if (k > 0 && opciones[k - 1] == "-i") {
+            error_code ec;
+            filesystem::path absoluta = filesystem::absolute(op, ec);
+            if (!ec) op = absoluta.string();
+        }
+        if (op.find_first_of(" \t\n") != string::npos) {
+            cerr << "Error: Las opciones no pueden contener espacios: " << op << endl;
+            return 1;
+        }
+        pedido += (k ? " " : "") + op;
+    }
+    pedido += '\n';
+
+    int fd = conectar(ruta_socket);
+    if (fd < 0) {
+        cerr << "Error: No se pudo conectar a " << ruta_socket << ": " << strerror(errno) << endl;
+        return 1;
+    }
+    if (!enviarTodo(fd, pedido)) {
+        cerr << "Error: No se pudo enviar el pedido" << endl;
+        close(fd);
+        return 1;
+    }
+    shutdown(fd, SHUT_WR);
+
+    // Copia la respuesta a medida que llega; recuerda la última línea
+    string respuesta;
+    string ultima;
+    char buf[4096];
+    ssize_t leidos;
+    while ((leidos = recv(fd, buf, sizeof(buf), 0)) > 0) {
+        respuesta.append(buf, static_cast<size_t>(leidos));
+        size_t fin;
+        while ((fin = respuesta.find('\n')) != string::npos) {
+            ultima = respuesta.substr(0, fin);
+            if (ultima.rfind("ERROR", 0) == 0) cerr << ultima << endl;
+            else if (!modo_irace) cout << ultima << '\n' << flush;
+            respuesta.erase(0, fin + 1);
+        }
+    }
+    close(fd);
+
+    if (ultima.rfind("ERROR", 0) == 0) return 1;
+    int calidad;
+    if (sscanf(ultima.c_str(), "Calidad: %d", &calidad) != 1) {
+        cerr << "Error: Respuesta incompleta del servidor" << endl;
+        return 1;
+    }
+    if (modo_irace) cout << -calidad << endl;
+    return 0;
+}
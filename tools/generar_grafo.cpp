@@ -0,0 +1,154 @@
+// Generador determinista de instancias sintéticas en el formato de entrada
+// del GA: una línea con n y luego una arista "u v" por línea.
+//
+// Familias:
+//   erdos      G(n, p) con saltos geométricos (Batagelj-Brandes), O(n + m)
+//   powerlaw   Chung-Lu con pesos w_i ~ (i + i0)^(-1/(gamma-1)) y saltos
+//              geométricos por fila (Miller-Hagberg), O(n + m)
+//   geometric  n puntos en el cuadrado unitario, arista si distancia <= r;
+//              celdas de lado r, solo se comparan celdas vecinas
+//   grid       grilla de floor(sqrt(n)) filas, vecinos a derecha y abajo
+//
+// Las aristas se escriben a medida que se generan: la memoria es O(1) para
+// erdos y grid, y O(n) para powerlaw y geometric (pesos y coordenadas),
+// nunca O(m). La misma semilla produce el mismo archivo. Los generadores
+// están en src/Generadores, compartidos con los benchmarks.
+//
+// Uso: ./tools/generar_grafo <familia> <n> [--grado d] [--p p] [--gamma g]
+//                            [--seed s] [-o archivo]
+
+#include "Generadores.h"
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+namespace {
+
+// Escritura con buffer propio (mucho más rápida que fprintf por arista)
+class EscritorAristas : public Generadores::Destino {
+public:
+    explicit EscritorAristas(FILE* f) : f(f), buffer(1 << 20), usado(0), aristas(0) {}
+    ~EscritorAristas() { vaciar(); }
+
+    void numero(uint64_t x) {
+        char tmp[24];
+        int k = 0;
+        do {
+            tmp[k++] = static_cast<char>('0' + x % 10);
+            x /= 10;
+        } while (x);
+        if (usado + k + 2 > buffer.size()) vaciar();
+        while (k) buffer[usado++] = tmp[--k];
+    }
+
+    void caracter(char c) {
+        if (usado + 1 > buffer.size()) vaciar();
+        buffer[usado++] = c;
+    }
+
+    void arista(int64_t u, int64_t v) override {
+        numero(static_cast<uint64_t>(u));
+        caracter(' ');
+        numero(static_cast<uint64_t>(v));
+        caracter('\n');
+        aristas++;
+    }
+
+    void vaciar() {
+        if (usado) fwrite(buffer.data(), 1, usado, f);
+        usado = 0;
+    }
+
+    uint64_t numAristas() const { return aristas; }
+
+private:
+    FILE* f;
+    std::vector<char> buffer;
+    size_t usado;
+    uint64_t aristas;
+};
+
+// Uniforme en (0, 1]
+void mostrarUso() {
+    cerr << "Uso: ./tools/generar_grafo <familia> <n> [opciones]" << endl;
+    cerr << "\nFamilias: erdos | powerlaw | geometric | grid" << endl;
+    cerr << "\nOpciones:" << endl;
+    cerr << "  --grado <d>   Grado medio esperado (default: 8; no aplica a grid)" << endl;
+    cerr << "  --p <p>       Probabilidad de arista para erdos (reemplaza --grado)" << endl;
+    cerr << "  --gamma <g>   Exponente de la ley de potencias, > 2 (default: 2.5)" << endl;
+    cerr << "  --seed <s>    Semilla (default: 1)" << endl;
+    cerr << "  -o <archivo>  Archivo de salida (default: salida estándar)" << endl;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    if (argc < 3) {
+        mostrarUso();
+        return 1;
+    }
+    string familia = argv[1];
+    int64_t n = atoll(argv[2]);
+    double grado = 8.0;
+    double p = -1.0;
+    double gamma = 2.5;
+    uint64_t semilla = 1;
+    string salida;
+
+    for (int i = 3; i < argc; ++i) {
+        string arg = argv[i];
+        if (arg == "--grado" && i + 1 < argc) grado = atof(argv[++i]);
+        else if (arg == "--p" && i + 1 < argc) p = atof(argv[++i]);
+        else if (arg == "--gamma" && i + 1 < argc) gamma = atof(argv[++i]);
+        else if (arg == "--seed" && i + 1 < argc) semilla = strtoull(argv[++i], nullptr, 10);
+        else if (arg == "-o" && i + 1 < argc) salida = argv[++i];
+        else {
+            cerr << "Error: Opción desconocida: " << arg << endl;
+            mostrarUso();
+            return 1;
+        }
+    }
+    if (!Generadores::familiaValida(familia)) {
+        cerr << "Error: Familia desconocida: " << familia << endl;
+        mostrarUso();
+        return 1;
+    }
+    if (n < 0 || n > INT32_MAX) {
+        cerr << "Error: n debe estar entre 0 y " << INT32_MAX << endl;
+        return 1;
+    }
+    if (familia == "powerlaw" && gamma <= 2.0) {
+        cerr << "Error: --gamma debe ser mayor que 2" << endl;
+        return 1;
+    }
+
+    FILE* f = salida.empty() ? stdout : fopen(salida.c_str(), "wb");
+    if (!f) {
+        cerr << "Error: No se pudo crear el archivo: " << salida << endl;
+        return 1;
+    }
+
+    uint64_t aristas = 0;
+    {
+        EscritorAristas out(f);
+        out.numero(static_cast<uint64_t>(n));
+        out.caracter('\n');
+        Generadores::generar(familia, n, grado, p, gamma, semilla, out);
+        aristas = out.numAristas();
+    }
+
+    bool ok = !ferror(f);
+    if (f != stdout) ok = (fclose(f) == 0) && ok;
+    if (!ok) {
+        cerr << "Error: Falló la escritura de " << (salida.empty() ? "la salida" : salida) << endl;
+        return 1;
+    }
+    cerr << familia << ": n = " << n << ", m = " << aristas << endl;
+    return 0;
+}